@@ -1,5 +1,9 @@
 #include "include/acpi.h"
+#include "include/inits.h"  // For INIT_CODE: ACPI discovery only runs at boot
 #include "include/io.h"     // For print_string, print_hex32, print_int, print_char, outb, inw, etc.
+#include "include/screens.h" // For screen_flush() before halting
+#include "include/serials.h" // For serial_flush() before halting
+#include "include/logs.h"   // For klog() during discovery
 #include "include/consts.h" // For VGA_COLOR_*, size_t from vectors.h via io.h might be used if not careful
 #include "include/vectors.h" // For size_t (if your size_t is defined here and not pulled in via other headers)
 
@@ -8,7 +12,7 @@ FADT* g_fadt = nullptr;
 
 // --- Helper: Custom memcmp ---
 // This is static, so its scope is limited to this file (acpi.cpp).
-static int memcmp_custom(const void* ptr1, const void* ptr2, size_t num) {
+INIT_CODE static int memcmp_custom(const void* ptr1, const void* ptr2, size_t num) {
     const unsigned char* p1 = (const unsigned char*)ptr1;
     const unsigned char* p2 = (const unsigned char*)ptr2;
     for (size_t i = 0; i < num; ++i) {
@@ -21,7 +25,7 @@ static int memcmp_custom(const void* ptr1, const void* ptr2, size_t num) {
 
 // --- ACPI Function Definitions ---
 
-bool validate_acpi_sdt_checksum(ACPISDTHeader* tableHeader) {
+INIT_CODE bool validate_acpi_sdt_checksum(ACPISDTHeader* tableHeader) {
     if (!tableHeader) return false; // Basic null check
     unsigned char sum = 0;
     for (uint32_t i = 0; i < tableHeader->Length; i++) {
@@ -30,7 +34,7 @@ bool validate_acpi_sdt_checksum(ACPISDTHeader* tableHeader) {
     return sum == 0;
 }
 
-void* find_rsdp() {
+INIT_CODE void* find_rsdp() {
     // Search in EBDA (Extended BIOS Data Area)
     // The EBDA pointer is at 0x40E in BDA (BIOS Data Area)
     uint16_t ebda_segment = *(uint16_t*)0x40E; // Direct memory access
@@ -54,12 +58,12 @@ void* find_rsdp() {
                                 sum += ((unsigned char*)rsdp20)[k];
                             }
                             if (sum == 0) {
-                                print_string("RSDP 2.0+ found in EBDA.\n", VGA_COLOR_WHITE);
+                                klog(KLOG_INFO, "acpi", "RSDP 2.0+ found in EBDA");
                                 return rsdp20;
                             }
                         }
                     } else { // ACPI 1.0 (Revision 0)
-                        print_string("RSDP 1.0 found in EBDA.\n", VGA_COLOR_WHITE);
+                        klog(KLOG_INFO, "acpi", "RSDP 1.0 found in EBDA");
                         return rsdp;
                     }
                 }
@@ -85,23 +89,23 @@ void* find_rsdp() {
                             sum += ((unsigned char*)rsdp20)[k];
                         }
                         if (sum == 0) {
-                            print_string("RSDP 2.0+ found in BIOS area.\n", VGA_COLOR_WHITE);
+                            klog(KLOG_INFO, "acpi", "RSDP 2.0+ found in BIOS area");
                             return rsdp20;
                         }
                     }
                 } else { // ACPI 1.0
-                    print_string("RSDP 1.0 found in BIOS area.\n", VGA_COLOR_WHITE);
+                    klog(KLOG_INFO, "acpi", "RSDP 1.0 found in BIOS area");
                     return rsdp;
                 }
             }
         }
     }
 
-    print_string("RSDP not found.\n", VGA_COLOR_LIGHT_RED);
+    klog(KLOG_ERR, "acpi", "RSDP not found");
     return nullptr;
 }
 
-ACPISDTHeader* find_sdt_from_rsdp(void* rsdp_ptr, const char* signature) {
+INIT_CODE ACPISDTHeader* find_sdt_from_rsdp(void* rsdp_ptr, const char* signature) {
     if (!rsdp_ptr || !signature) { // Check signature for null as well
         return nullptr;
     }
@@ -114,36 +118,36 @@ ACPISDTHeader* find_sdt_from_rsdp(void* rsdp_ptr, const char* signature) {
     if (use_xsdt) {
         RSDPDescriptor20* rsdp_v2 = (RSDPDescriptor20*)rsdp_ptr;
         if (rsdp_v2->XsdtAddress == 0) { // Check for null XSDT address
-            print_string("XSDT address is NULL in RSDP v2.0+, falling back to RSDT if available.\n", VGA_COLOR_YELLOW);
+            klog(KLOG_WARN, "acpi", "XSDT address is NULL in RSDP v2.0+, falling back to RSDT if available");
             use_xsdt = false; // Fallback to RSDT
         } else {
             sdt_root_table = (ACPISDTHeader*)((uintptr_t)rsdp_v2->XsdtAddress);
             if (!sdt_root_table || !validate_acpi_sdt_checksum(sdt_root_table)) {
-                print_string("XSDT invalid or checksum failed.\n", VGA_COLOR_LIGHT_RED);
+                klog(KLOG_ERR, "acpi", "XSDT invalid or checksum failed");
                 return nullptr;
             }
             // Length of XSDT - size of header = size of pointer array
             // Each entry in XSDT is 8 bytes (uint64_t)
             entries = (sdt_root_table->Length - sizeof(ACPISDTHeader)) / 8;
-            print_string("Using XSDT. Entries: ", VGA_COLOR_WHITE); print_int(entries); print_char('\n');
+            klog(KLOG_INFO, "acpi", "Using XSDT. Entries: %d", entries);
         }
     }
     
     // If not using XSDT (either ACPI 1.0 or XSDT fallback)
     if (!use_xsdt) { 
         if (rsdp_v1->RsdtAddress == 0) { // Check for null RSDT address
-             print_string("RSDT address is NULL.\n", VGA_COLOR_LIGHT_RED);
+             klog(KLOG_ERR, "acpi", "RSDT address is NULL");
              return nullptr;
         }
         sdt_root_table = (ACPISDTHeader*)((uintptr_t)rsdp_v1->RsdtAddress);
         if (!sdt_root_table || !validate_acpi_sdt_checksum(sdt_root_table)) {
-             print_string("RSDT invalid or checksum failed.\n", VGA_COLOR_LIGHT_RED);
+             klog(KLOG_ERR, "acpi", "RSDT invalid or checksum failed");
              return nullptr;
         }
         // Length of RSDT - size of header = size of pointer array
         // Each entry in RSDT is 4 bytes (uint32_t)
         entries = (sdt_root_table->Length - sizeof(ACPISDTHeader)) / 4;
-        print_string("Using RSDT. Entries: ", VGA_COLOR_WHITE); print_int(entries); print_char('\n');
+        klog(KLOG_INFO, "acpi", "Using RSDT. Entries: %d", entries);
     }
 
 
@@ -158,70 +162,46 @@ ACPISDTHeader* find_sdt_from_rsdp(void* rsdp_ptr, const char* signature) {
         }
 
         if (!h) { // Check for null pointer in the table entries
-            print_string("Null SDT pointer encountered in (X)RSDT.\n", VGA_COLOR_YELLOW);
+            klog(KLOG_WARN, "acpi", "Null SDT pointer encountered in (X)RSDT");
             continue; 
         }
 
         // Use the 'signature' parameter here
         if (memcmp_custom(h->Signature, signature, 4) == 0) {
             if (validate_acpi_sdt_checksum(h)) {
-                print_string("Found table: ", VGA_COLOR_GREEN);
-                // Create a null-terminated buffer for the signature for printing
-                char sig_buf[5];
-                sig_buf[0] = signature[0]; sig_buf[1] = signature[1];
-                sig_buf[2] = signature[2]; sig_buf[3] = signature[3];
-                sig_buf[4] = '\0';
-                print_string(sig_buf, VGA_COLOR_GREEN); print_char('\n');
+                klog(KLOG_INFO, "acpi", "Found table: %.4s", signature);
                 return h;
             } else {
-                print_string("Found table '", VGA_COLOR_LIGHT_RED);
-                char sig_buf[5];
-                sig_buf[0] = signature[0]; sig_buf[1] = signature[1];
-                sig_buf[2] = signature[2]; sig_buf[3] = signature[3];
-                sig_buf[4] = '\0';
-                print_string(sig_buf, VGA_COLOR_LIGHT_RED);
-                print_string("' but its checksum failed.\n", VGA_COLOR_LIGHT_RED);
+                klog(KLOG_ERR, "acpi", "Found table '%.4s' but its checksum failed", signature);
             }
         }
     }
 
-    print_string("Table '", VGA_COLOR_LIGHT_RED);
-    char sig_buf[5];
-    sig_buf[0] = signature[0]; sig_buf[1] = signature[1];
-    sig_buf[2] = signature[2]; sig_buf[3] = signature[3];
-    sig_buf[4] = '\0';
-    print_string(sig_buf, VGA_COLOR_LIGHT_RED);
-    print_string("' not found in (X)RSDT.\n", VGA_COLOR_LIGHT_RED);
+    klog(KLOG_ERR, "acpi", "Table '%.4s' not found in (X)RSDT", signature);
     return nullptr;
 }
 
-void acpi_init() {
-    void* rsdp = find_rsdp(); // find_rsdp() prints messages
+INIT_CODE void acpi_init() {
+    void* rsdp = find_rsdp(); // find_rsdp() logs messages
     if (!rsdp) {
-        // find_rsdp already printed "RSDP not found."
-        print_string("ACPI initialization failed: RSDP not found.\n", VGA_COLOR_LIGHT_RED);
+        // find_rsdp already logged "RSDP not found"
+        klog(KLOG_ERR, "acpi", "ACPI initialization failed: RSDP not found");
         return;
     }
 
     g_fadt = (FADT*)find_sdt_from_rsdp(rsdp, "FACP"); // "FACP" is the signature for FADT
     if (g_fadt) {
-        print_string("FADT found. SCI_Interrupt: ", VGA_COLOR_GREEN);
-        print_int(g_fadt->SCI_Interrupt, VGA_COLOR_GREEN);
-        print_string(", PM1aCtrlBlk: 0x", VGA_COLOR_GREEN);
         if (g_fadt->PM1aControlBlock) {
-            print_hex32(g_fadt->PM1aControlBlock, VGA_COLOR_GREEN);
+            klog(KLOG_INFO, "acpi", "FADT found. SCI_Interrupt: %u, PM1aCtrlBlk: %#x",
+                 (unsigned)g_fadt->SCI_Interrupt, (unsigned)g_fadt->PM1aControlBlock);
         } else {
-            print_string("N/A", VGA_COLOR_YELLOW);
+            klog(KLOG_WARN, "acpi", "FADT found. SCI_Interrupt: %u, PM1aCtrlBlk: N/A", (unsigned)g_fadt->SCI_Interrupt);
         }
-        print_char('\n');
 
         // Enable ACPI mode if SMI_CommandPort, AcpiEnable, and PM1aEventBlock are valid
         if (g_fadt->SMI_CommandPort && g_fadt->AcpiEnable && g_fadt->PM1aEventBlock) {
-            print_string("Attempting to enable ACPI mode (writing to SMI_CMD 0x", VGA_COLOR_WHITE);
-            print_hex32(g_fadt->SMI_CommandPort, VGA_COLOR_WHITE);
-            print_string(" value 0x", VGA_COLOR_WHITE);
-            print_hex32(g_fadt->AcpiEnable, VGA_COLOR_WHITE);
-            print_string(")\n", VGA_COLOR_WHITE);
+            klog(KLOG_INFO, "acpi", "Attempting to enable ACPI mode (writing to SMI_CMD %#x value %#x)",
+                 (unsigned)g_fadt->SMI_CommandPort, (unsigned)g_fadt->AcpiEnable);
 
             outb(g_fadt->SMI_CommandPort, g_fadt->AcpiEnable);
 
@@ -239,21 +219,18 @@ void acpi_init() {
             }
 
             if (sci_enabled) {
-                 print_string("ACPI mode enabled (SCI_EN bit is set in PM1aEventBlock).\n", VGA_COLOR_GREEN);
+                 klog(KLOG_INFO, "acpi", "ACPI mode enabled (SCI_EN bit is set in PM1aEventBlock)");
             } else {
-                print_string("Timeout or failure enabling ACPI mode (SCI_EN not set).\n", VGA_COLOR_LIGHT_RED);
-                print_string("PM1aEventBlock (0x", VGA_COLOR_YELLOW);
-                print_hex32(g_fadt->PM1aEventBlock, VGA_COLOR_YELLOW);
-                print_string(") current value: 0x", VGA_COLOR_YELLOW);
-                print_hex32(inw(g_fadt->PM1aEventBlock), VGA_COLOR_YELLOW); // Print current value of PM1a status
-                print_char('\n');
+                klog(KLOG_ERR, "acpi", "Timeout or failure enabling ACPI mode (SCI_EN not set)");
+                klog(KLOG_WARN, "acpi", "PM1aEventBlock (%#x) current value: %#x", // Current value of PM1a status
+                     (unsigned)g_fadt->PM1aEventBlock, (unsigned)inw(g_fadt->PM1aEventBlock));
             }
         } else {
-            print_string("Cannot attempt to enable ACPI mode: SMI_CommandPort, AcpiEnable, or PM1aEventBlock is zero in FADT.\n", VGA_COLOR_YELLOW);
+            klog(KLOG_WARN, "acpi", "Cannot attempt to enable ACPI mode: SMI_CommandPort, AcpiEnable, or PM1aEventBlock is zero in FADT");
         }
     } else {
-        // find_sdt_from_rsdp already printed "Table 'FACP' not found."
-        print_string("ACPI initialization failed: FADT not found.\n", VGA_COLOR_LIGHT_RED);
+        // find_sdt_from_rsdp already logged "Table 'FACP' not found"
+        klog(KLOG_ERR, "acpi", "ACPI initialization failed: FADT not found");
     }
 }
 
@@ -339,10 +316,14 @@ void acpi_reboot() {
     // If the write didn't immediately reboot, wait a bit then halt
     print_string("ACPI Reboot command sent. Waiting...\n", VGA_COLOR_YELLOW);
 
+    screen_flush(); // The delay and halt below never return to the shell
+    serial_flush();
     // Crude delay
     for(volatile int i=0; i < 5000000; ++i); // Adjust count as needed
 
     print_string("ACPI Reboot failed? Halting.\n", VGA_COLOR_LIGHT_RED);
+    screen_flush();
+    serial_flush();
     // Fallback halt
     while (true) {
         asm volatile("cli; hlt");
@@ -368,6 +349,8 @@ void acpi_keyboard_reboot() {
 
     // If that didn't work, halt
     print_string("Keyboard controller reboot command sent. Halting if it fails.\n", VGA_COLOR_YELLOW);
+    screen_flush();
+    serial_flush();
     while(true) {
          asm volatile ("hlt");
     }
@@ -415,6 +398,8 @@ void acpi_power_off() {
 
     print_string("Shutdown command sent. System should power off.\n", VGA_COLOR_YELLOW);
     print_string("If not, this ACPI S5 method may be unsupported or require DSDT parsing for SLP_TYPa/b values.\n", VGA_COLOR_YELLOW);
+    screen_flush();
+    serial_flush();
 
     // Halt indefinitely
     while (true) {
@@ -0,0 +1,109 @@
+#include "include/arenas.h"
+
+// --- Chunk Management ---
+
+// Makes 'current' a chunk with room for 'bytes' at 'align'. The spare chunk is
+// reused when it is big enough, otherwise a new one comes from the heap.
+bool arena::grow(size_t bytes, size_t align) {
+    size_t need = bytes + align; // Worst-case alignment padding
+    if (need < bytes) return false; // Overflow
+
+    chunk* c = nullptr;
+    if (spare && spare->size >= need) {
+        c = spare;
+        spare = nullptr;
+    } else {
+        size_t size = need > chunk_size ? need : chunk_size;
+        c = static_cast<chunk*>(kmalloc(sizeof(chunk) + size));
+        if (!c) return false;
+        c->size = size;
+    }
+
+    c->used = 0;
+    c->prev = current;
+    current = c;
+    return true;
+}
+
+arena::~arena() {
+    release();
+}
+
+void* arena::alloc(size_t bytes, size_t align) {
+    if (align < sizeof(void*)) align = sizeof(void*);
+
+    if (current) {
+        uintptr_t base = reinterpret_cast<uintptr_t>(current + 1);
+        uintptr_t p = (base + current->used + align - 1) & ~(uintptr_t)(align - 1);
+        if (p - base <= current->size && bytes <= current->size - (p - base)) {
+            current->used = (p - base) + bytes;
+            last_alloc = reinterpret_cast<void*>(p);
+            return last_alloc;
+        }
+    }
+
+    if (!grow(bytes, align)) return nullptr;
+
+    uintptr_t base = reinterpret_cast<uintptr_t>(current + 1);
+    uintptr_t p = (base + align - 1) & ~(uintptr_t)(align - 1);
+    current->used = (p - base) + bytes;
+    last_alloc = reinterpret_cast<void*>(p);
+    return last_alloc;
+}
+
+void arena::deallocate(void* ptr, size_t, size_t) {
+    if (!ptr || ptr != last_alloc || !current) return;
+    current->used = reinterpret_cast<uintptr_t>(ptr) - reinterpret_cast<uintptr_t>(current + 1);
+    last_alloc = nullptr;
+}
+
+bool arena::try_expand(void* ptr, size_t new_bytes, size_t) {
+    if (!ptr || ptr != last_alloc || !current) return false;
+
+    size_t offset = reinterpret_cast<uintptr_t>(ptr) - reinterpret_cast<uintptr_t>(current + 1);
+    if (new_bytes > current->size - offset) return false;
+
+    if (offset + new_bytes > current->used) current->used = offset + new_bytes;
+    return true;
+}
+
+// --- Rewinding ---
+
+void arena::rewind(marker m) {
+    // Common case: nothing spilled into a new chunk since the marker, so this
+    // is a single store.
+    while (current && current != m.at) {
+        chunk* c = current;
+        current = c->prev;
+
+        // Keep one default-sized chunk around, so a loop that allocates and
+        // rewinds does not hit the heap every iteration.
+        if (!spare && c->size == chunk_size) {
+            spare = c;
+        } else {
+            kfree(c);
+        }
+    }
+    if (current) current->used = m.used;
+    last_alloc = nullptr;
+}
+
+void arena::release() {
+    reset();
+    kfree(spare);
+    spare = nullptr;
+}
+
+// --- Statistics ---
+
+size_t arena::bytes_used() const {
+    size_t total = 0;
+    for (chunk* c = current; c; c = c->prev) total += c->used;
+    return total;
+}
+
+size_t arena::bytes_reserved() const {
+    size_t total = spare ? spare->size : 0;
+    for (chunk* c = current; c; c = c->prev) total += c->size;
+    return total;
+}
@@ -19,6 +19,9 @@ align 4
 mboot_info_ptr:
     dd 0                         ; Store multiboot info pointer here
 
+; Fill pattern for unused stack. Must match STACK_PAINT in include/stacks.h.
+STACK_PAINT equ 0x57AC57AC
+
 section .bss
 align 16
 stack_bottom:
@@ -28,6 +31,8 @@ stack_top:
 section .text
 global _start
 global mboot_info_ptr            ; Export address of the storage for the pointer
+global stack_bottom              ; Export the boot stack bounds for the stack profiler
+global stack_top
 extern kernel_main               ; C++ kernel entry point
 
 ; GDT Selectors (makes code more readable)
@@ -41,6 +46,15 @@ _start:
     ; Save multiboot info pointer passed in ebx by GRUB
     mov [mboot_info_ptr], ebx
 
+    ; Paint the whole stack before first use. Words that still hold the
+    ; pattern later were never touched, which gives the high-water mark
+    ; (see stacks.cpp).
+    cld
+    mov edi, stack_bottom
+    mov ecx, (stack_top - stack_bottom) / 4
+    mov eax, STACK_PAINT
+    rep stosd
+
     ; Set up the stack
     mov esp, stack_top
 
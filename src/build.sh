@@ -12,16 +12,16 @@ set -e
 # -O2: Optimization level 2
 # -Wall: Enable all warnings (good practice)
 # -Wextra: Enable extra warnings (good practice)
-# -std=c++11: Or c++14, c++17, c++20 depending on features used (e.g., noexcept, alignas)
+# -std=c++17: Needed for aligned operator new (std::align_val_t) and sized delete
 # -Iinclude: Tell compiler where to find headers (e.g., include/consts.h)
 # -Wno-unused-parameter: Temporarily suppress unused param warnings if needed (e.g. for 'signature' if it persists)
 # -Wno-unused-variable: Temporarily suppress unused var warnings if needed
-CFLAGS="-m32 -ffreestanding -fno-exceptions -fno-rtti -O2 -Wall -Wextra -std=c++11 -Iinclude"
+CFLAGS="-m32 -ffreestanding -fno-exceptions -fno-rtti -O2 -Wall -Wextra -std=c++17 -Iinclude"
 LINKER_SCRIPT="linker.ld" # Define the linker script name
 
 # Source files (add all your .cpp files here)
-CPP_SOURCES="kernel.cpp consts.cpp memorys.cpp screens.cpp io.cpp acpi.cpp"
-ASM_SOURCES="boot.asm"
+CPP_SOURCES="kernel.cpp consts.cpp memorys.cpp pages.cpp arenas.cpp strings.cpp formats.cpp logs.cpp stacks.cpp interrupts.cpp serials.cpp keyboards.cpp screens.cpp io.cpp acpi.cpp"
+ASM_SOURCES="boot.asm isr_assembly.asm"
 
 # Object files will be placed in build/
 # Create an array to hold object file names
@@ -105,4 +105,4 @@ echo "Build complete. ISO created: $ISO_NAME"
 
 # --- Run (optional) ---
 echo "Running Cinemint OS in QEMU..."
-qemu-system-i386 -cdrom "$ISO_NAME"
\ No newline at end of file
+qemu-system-i386 -cdrom "$ISO_NAME" -serial stdio # Console output is mirrored to COM1
\ No newline at end of file
@@ -0,0 +1,317 @@
+#include "include/formats.h"
+#include "include/io.h" // For console_write()
+
+// --- Number Conversion ---
+
+static const char digit_pairs[201] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+static const char digits_lower[] = "0123456789abcdef";
+static const char digits_upper[] = "0123456789ABCDEF";
+
+// Decimal digits of a 32-bit value, two per step
+static char* put_dec32(char* end, uint32_t n) {
+    while (n >= 100) {
+        uint32_t pair = (n % 100) * 2;
+        n /= 100;
+        end -= 2;
+        end[0] = digit_pairs[pair];
+        end[1] = digit_pairs[pair + 1];
+    }
+    if (n >= 10) {
+        end -= 2;
+        end[0] = digit_pairs[n * 2];
+        end[1] = digit_pairs[n * 2 + 1];
+    } else {
+        *--end = (char)('0' + n);
+    }
+    return end;
+}
+
+char* format_uint(char* end, uint64_t n, unsigned base, bool upper) {
+    const char* digits = upper ? digits_upper : digits_lower;
+
+    if (base == 10) {
+        // Peel off 9 digits at a time until the rest fits 32 bits.
+        while (n > 0xFFFFFFFFull) {
+            uint32_t chunk = divmod_u64(n, 1000000000);
+            char* start = put_dec32(end, chunk);
+            while (end - start < 9) {
+                *--start = '0';
+            }
+            end = start;
+        }
+        return put_dec32(end, (uint32_t)n);
+    }
+
+    if ((base & (base - 1)) == 0) {
+        unsigned shift = __builtin_ctz(base);
+        uint32_t mask = base - 1;
+        do {
+            *--end = digits[n & mask];
+            n >>= shift;
+        } while (n);
+        return end;
+    }
+
+    do {
+        *--end = digits[divmod_u64(n, base)];
+    } while (n);
+    return end;
+}
+
+// --- Output Sink ---
+// Characters collect in 'buf'. When it is full they are handed to 'flush'
+// (the console) or, for ksnprintf, dropped while still being counted.
+struct format_sink {
+    char* buf;
+    size_t cap;
+    size_t len;
+    size_t total; // Every character produced, including dropped ones
+    void (*flush)(format_sink* sink);
+    int color;
+};
+
+static inline void sink_put(format_sink* s, char c) {
+    if (s->len == s->cap) {
+        if (!s->flush) {
+            s->total++;
+            return;
+        }
+        s->flush(s);
+    }
+    s->buf[s->len++] = c;
+    s->total++;
+}
+
+static void sink_repeat(format_sink* s, char c, int count) {
+    for (int i = 0; i < count; ++i) {
+        sink_put(s, c);
+    }
+}
+
+static void sink_write(format_sink* s, const char* str, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        sink_put(s, str[i]);
+    }
+}
+
+static void console_flush(format_sink* s) {
+    console_write(s->buf, s->len, s->color);
+    s->len = 0;
+}
+
+// --- Formatter ---
+
+#define FLAG_LEFT  0x01 // '-'
+#define FLAG_ZERO  0x02 // '0'
+#define FLAG_PLUS  0x04 // '+'
+#define FLAG_SPACE 0x08 // ' '
+#define FLAG_ALT   0x10 // '#'
+
+// Emits 'body' (length n) with an optional prefix ("-", "0x", ...) padded to
+// 'width' as the flags ask. 'precision' is the minimum digit count (-1: none).
+static void emit_number(format_sink* s, const char* prefix, const char* body, int n,
+                        int flags, int width, int precision) {
+    int prefix_len = 0;
+    while (prefix[prefix_len]) {
+        prefix_len++;
+    }
+    int zeros = precision > n ? precision - n : 0;
+    int pad = width - prefix_len - zeros - n;
+    if (pad < 0) pad = 0;
+
+    if ((flags & FLAG_ZERO) && !(flags & FLAG_LEFT) && precision < 0) {
+        zeros += pad; // Zero padding goes between the prefix and the digits
+        pad = 0;
+    }
+    if (!(flags & FLAG_LEFT)) sink_repeat(s, ' ', pad);
+    sink_write(s, prefix, prefix_len);
+    sink_repeat(s, '0', zeros);
+    sink_write(s, body, n);
+    if (flags & FLAG_LEFT) sink_repeat(s, ' ', pad);
+}
+
+static void format_to(format_sink* s, const char* fmt, va_list args) {
+    char digits[66];
+    char* const digits_end = digits + sizeof(digits);
+
+    while (*fmt) {
+        if (*fmt != '%') {
+            // Copy literal text up to the next conversion
+            sink_put(s, *fmt++);
+            continue;
+        }
+        fmt++;
+
+        int flags = 0;
+        for (;; fmt++) {
+            if (*fmt == '-') flags |= FLAG_LEFT;
+            else if (*fmt == '0') flags |= FLAG_ZERO;
+            else if (*fmt == '+') flags |= FLAG_PLUS;
+            else if (*fmt == ' ') flags |= FLAG_SPACE;
+            else if (*fmt == '#') flags |= FLAG_ALT;
+            else break;
+        }
+
+        int width = 0;
+        if (*fmt == '*') {
+            width = va_arg(args, int);
+            if (width < 0) {
+                flags |= FLAG_LEFT;
+                width = -width;
+            }
+            fmt++;
+        } else {
+            while (*fmt >= '0' && *fmt <= '9') {
+                width = width * 10 + (*fmt++ - '0');
+            }
+        }
+
+        int precision = -1;
+        if (*fmt == '.') {
+            fmt++;
+            precision = 0;
+            if (*fmt == '*') {
+                precision = va_arg(args, int);
+                if (precision < 0) precision = -1;
+                fmt++;
+            } else {
+                while (*fmt >= '0' && *fmt <= '9') {
+                    precision = precision * 10 + (*fmt++ - '0');
+                }
+            }
+        }
+
+        int longs = 0;  // 1 = l, 2 = ll (size_t is 32 bits here, so z is plain)
+        int shorts = 0; // 1 = h, 2 = hh: the int argument is cut back to short / char
+        while (*fmt == 'l' || *fmt == 'h' || *fmt == 'z') {
+            if (*fmt == 'l') longs++;
+            if (*fmt == 'h') shorts++;
+            fmt++;
+        }
+
+        char conv = *fmt;
+        if (conv == '\0') break;
+        fmt++;
+
+        switch (conv) {
+            case 'd':
+            case 'i': {
+                long long v = longs >= 2 ? va_arg(args, long long)
+                            : longs == 1 ? va_arg(args, long)
+                            : va_arg(args, int);
+                if (longs == 0 && shorts >= 2) v = (signed char)v;
+                else if (longs == 0 && shorts == 1) v = (short)v;
+                // Negate as unsigned: also right for the most negative value
+                uint64_t mag = v < 0 ? 0 - (uint64_t)v : (uint64_t)v;
+                const char* sign = v < 0 ? "-" : (flags & FLAG_PLUS) ? "+" : (flags & FLAG_SPACE) ? " " : "";
+                char* p = format_uint(digits_end, mag, 10);
+                int n = (int)(digits_end - p);
+                if (precision == 0 && mag == 0) n = 0;
+                emit_number(s, sign, p, n, flags, width, precision);
+                break;
+            }
+            case 'u':
+            case 'x':
+            case 'X': {
+                uint64_t v = longs >= 2 ? va_arg(args, unsigned long long)
+                           : longs == 1 ? va_arg(args, unsigned long)
+                           : va_arg(args, unsigned int);
+                if (longs == 0 && shorts >= 2) v = (unsigned char)v;
+                else if (longs == 0 && shorts == 1) v = (unsigned short)v;
+                unsigned base = conv == 'u' ? 10 : 16;
+                char* p = format_uint(digits_end, v, base, conv == 'X');
+                int n = (int)(digits_end - p);
+                if (precision == 0 && v == 0) n = 0;
+                const char* prefix = (base == 16 && (flags & FLAG_ALT) && v != 0) ? (conv == 'X' ? "0X" : "0x") : "";
+                emit_number(s, prefix, p, n, flags, width, precision);
+                break;
+            }
+            case 'p': {
+                uintptr_t v = (uintptr_t)va_arg(args, void*);
+                char* p = format_uint(digits_end, v, 16);
+                int n = (int)(digits_end - p);
+                emit_number(s, "0x", p, n, flags, width, (int)(sizeof(void*) * 2));
+                break;
+            }
+            case 's': {
+                const char* str = va_arg(args, const char*);
+                if (!str) str = "(null)";
+                int n = 0;
+                while ((precision < 0 || n < precision) && str[n]) {
+                    n++;
+                }
+                int pad = width > n ? width - n : 0;
+                if (!(flags & FLAG_LEFT)) sink_repeat(s, ' ', pad);
+                sink_write(s, str, n);
+                if (flags & FLAG_LEFT) sink_repeat(s, ' ', pad);
+                break;
+            }
+            case 'c': {
+                char c = (char)va_arg(args, int);
+                int pad = width > 1 ? width - 1 : 0;
+                if (!(flags & FLAG_LEFT)) sink_repeat(s, ' ', pad);
+                sink_put(s, c);
+                if (flags & FLAG_LEFT) sink_repeat(s, ' ', pad);
+                break;
+            }
+            case '%':
+                sink_put(s, '%');
+                break;
+            default:
+                // Unknown conversion: show it as written
+                sink_put(s, '%');
+                sink_put(s, conv);
+                break;
+        }
+    }
+}
+
+// --- Public Interface ---
+
+int kvsnprintf(char* buf, size_t size, const char* fmt, va_list args) {
+    char dummy;
+    format_sink s = { size ? buf : &dummy, size ? size - 1 : 0, 0, 0, nullptr, 0 };
+    format_to(&s, fmt, args);
+    if (size) {
+        buf[s.len] = '\0';
+    }
+    return (int)s.total;
+}
+
+int ksnprintf(char* buf, size_t size, const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    int n = kvsnprintf(buf, size, fmt, args);
+    va_end(args);
+    return n;
+}
+
+int kvprintf_color(int color, const char* fmt, va_list args) {
+    char buf[KPRINTF_BUFFER_SIZE];
+    format_sink s = { buf, sizeof(buf), 0, 0, console_flush, color };
+    format_to(&s, fmt, args);
+    if (s.len) {
+        console_flush(&s);
+    }
+    return (int)s.total;
+}
+
+int kprintf_color(int color, const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    int n = kvprintf_color(color, fmt, args);
+    va_end(args);
+    return n;
+}
+
+int kprintf(const char* fmt, ...) {
+    va_list args;
+    va_start(args, fmt);
+    int n = kvprintf_color(VGA_COLOR_LIGHT_GREY, fmt, args);
+    va_end(args);
+    return n;
+}
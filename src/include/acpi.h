@@ -139,6 +139,9 @@ const uint16_t SLP_EN_PM1_CNT     = (1 << 13); // Sleep Enable bit (bit 13) for
 
 
 // --- Function Declarations (to be implemented in a .cpp file) ---
+// Table discovery (validate_acpi_sdt_checksum, find_rsdp, find_sdt_from_rsdp
+// and acpi_init) is boot-only code: it is freed by free_init_memory() and
+// must not be called afterwards. Power-off and reboot only use g_fadt.
 
 /**
  * @brief Validates the checksum of an ACPI System Description Table.
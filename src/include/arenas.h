@@ -0,0 +1,100 @@
+#ifndef ARENAS_H
+#define ARENAS_H
+
+#include "memorys.h" // For size_t, mem_resource and the kernel heap
+
+// --- Arena (Region) Allocator ---
+// Bump allocation out of chunks taken from the kernel heap. Individual frees
+// are not tracked: memory is given back all at once by rewinding to a marker
+// taken earlier, which only resets the bump pointer (chunks grown past the
+// marker are released too, but one of them is kept for the next round).
+// Meant for short-lived allocations with a clear end, like the temporaries of
+// one shell command.
+
+#define ARENA_DEFAULT_ALIGN 16
+// A bit under 16 KiB, so that a chunk plus the heap's block header still fits
+// a 4-page block instead of spilling into an 8-page one.
+#define ARENA_CHUNK_SIZE    (4 * 4096 - 64)
+
+class arena : public mem_resource {
+private:
+    struct chunk {
+        chunk* prev;  // Older chunk, nullptr for the first
+        size_t size;  // Usable bytes after the header
+        size_t used;  // Bytes handed out from this chunk
+    };
+
+    chunk* current;    // Chunk being allocated from (newest)
+    chunk* spare;      // One released chunk kept for reuse, or nullptr
+    size_t chunk_size; // Usable bytes of a default-sized chunk
+    void* last_alloc;  // Most recent allocation, can be popped by deallocate()
+
+    bool grow(size_t bytes, size_t align);
+
+public:
+    // Position in the arena. Rewinding to it frees everything allocated since.
+    struct marker {
+        chunk* at;
+        size_t used;
+    };
+
+    constexpr explicit arena(size_t default_chunk_size = ARENA_CHUNK_SIZE)
+        : current(nullptr), spare(nullptr), chunk_size(default_chunk_size), last_alloc(nullptr) {}
+    ~arena();
+
+    arena(const arena&) = delete;
+    arena& operator=(const arena&) = delete;
+
+    /**
+     * @brief Bump-allocates 'bytes' bytes. 'align' must be a power of two.
+     * @return The memory, or nullptr if no new chunk could be allocated.
+     */
+    void* alloc(size_t bytes, size_t align = ARENA_DEFAULT_ALIGN);
+
+    marker mark() const {
+        return marker{current, current ? current->used : 0};
+    }
+
+    // Frees everything allocated after 'm' was taken. Markers taken after 'm'
+    // become invalid.
+    void rewind(marker m);
+
+    // Frees every allocation, keeping one chunk for reuse.
+    void reset() {
+        rewind(marker{nullptr, 0});
+    }
+
+    // Returns every chunk to the kernel heap.
+    void release();
+
+    size_t bytes_used() const;     // Bytes handed out (including alignment padding)
+    size_t bytes_reserved() const; // Bytes held in chunks, including the spare
+
+    // --- mem_resource ---
+    void* allocate(size_t bytes, size_t align) override {
+        return alloc(bytes, align);
+    }
+
+    // Only the most recent allocation is actually given back; anything else
+    // waits for the next rewind.
+    void deallocate(void* ptr, size_t bytes, size_t align) override;
+
+    // The most recent allocation can grow while its chunk has room.
+    bool try_expand(void* ptr, size_t new_bytes, size_t align) override;
+};
+
+// Rewinds the arena to where it was when the scope was entered.
+class arena_scope {
+private:
+    arena& a;
+    arena::marker m;
+
+public:
+    explicit arena_scope(arena& scoped) : a(scoped), m(scoped.mark()) {}
+    ~arena_scope() { a.rewind(m); }
+
+    arena_scope(const arena_scope&) = delete;
+    arena_scope& operator=(const arena_scope&) = delete;
+};
+
+#endif // ARENAS_H
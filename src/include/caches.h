@@ -0,0 +1,58 @@
+#ifndef CACHES_H
+#define CACHES_H
+
+#include "memorys.h" // For size_t and the kernel heap
+#include "vectors.h" // For placement new
+
+// --- Object Caches ---
+// A kmem_cache hands out fixed-size objects from dedicated slabs. Objects are
+// constructed once, when their slab is created, and are expected to be given
+// back with kmem_cache_free() in a reusable (constructed) state. That saves
+// re-initialising objects that are allocated and freed often.
+struct kmem_cache;
+
+/**
+ * @brief Creates a cache for objects of 'size' bytes.
+ * @param name  Label used in statistics. Must stay valid (use a literal).
+ * @param align Power of two, 0 for the default 16-byte alignment. Objects must
+ *              fit in a single 4 KiB slab; page-aligned objects should use
+ *              aligned operator new instead.
+ * @param ctor  Optional, called once per object when its slab is created.
+ * @return The cache, or nullptr if the layout is impossible or memory ran out.
+ */
+kmem_cache* kmem_cache_create(const char* name, size_t size, size_t align, void (*ctor)(void*));
+
+void* kmem_cache_alloc(kmem_cache* cache);
+void kmem_cache_free(kmem_cache* cache, void* obj);
+
+// Typed wrapper. The constructor is constexpr, so a global object_cache needs
+// no runtime initialisation (global constructors are not run by boot.asm); the
+// underlying kmem_cache is created on first use.
+template <typename T>
+class object_cache {
+private:
+    const char* name;
+    kmem_cache* cache;
+
+    static void construct(void* p) {
+        new (p) T();
+    }
+
+public:
+    constexpr explicit object_cache(const char* cache_name) : name(cache_name), cache(nullptr) {}
+
+    // Returns a constructed object, or nullptr when out of memory.
+    T* alloc() {
+        if (!cache) {
+            cache = kmem_cache_create(name, sizeof(T), alignof(T), construct);
+        }
+        return static_cast<T*>(kmem_cache_alloc(cache));
+    }
+
+    // The object is not destroyed; it must be left in a state fit for reuse.
+    void free(T* obj) {
+        kmem_cache_free(cache, obj);
+    }
+};
+
+#endif // CACHES_H
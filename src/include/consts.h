@@ -33,6 +33,10 @@ enum vga_color
 #define SHIFT_RELEASED_RIGHT 0xB6
 #define BACKSPACE           0x0E
 #define ENTER               0x1C // Common scancode for Enter key (Set 1)
+#define KEY_EXTENDED        0x100 // Added to keys sent with an E0 prefix (keyboards.h)
+#define KEYPAD_ENTER        (KEY_EXTENDED | 0x1C)
+#define PAGE_UP             (KEY_EXTENDED | 0x49) // Without the prefix: keypad 9
+#define PAGE_DOWN           (KEY_EXTENDED | 0x51) // Without the prefix: keypad 3
 #define KEY_LIMIT           59   // Ensure this matches the size of your scancode arrays
 
 // --- VGA Text Mode Constants (Declarations) ---
@@ -0,0 +1,65 @@
+#ifndef FORMATS_H
+#define FORMATS_H
+
+#include <stdarg.h>  // For va_list (provided by the compiler, fine in freestanding)
+#include <stdint.h>  // For uint64_t
+#include "vectors.h" // For size_t
+#include "consts.h"  // For VGA_COLOR_*
+
+// --- Formatted Output ---
+// printf-style formatting done in one pass into a stack buffer. The finished
+// text reaches the console as one batched write per buffer instead of one
+// print_char() call per character.
+//
+// Supported: %d %i %u %x %X %p %s %c %%, flags '-' '0' '+' ' ' '#', a field
+// width and precision (either may be '*'), and the length modifiers hh, h,
+// l, ll and z. "%.*s" prints a string_view: (int)sv.size(), sv.data().
+//
+// Numbers are converted without 64-bit division, so no libgcc helper is
+// called per digit: decimal digits come two at a time from a table (with
+// 64-bit values split into 9-digit chunks by two 32-bit divl), hex and other
+// power-of-two bases by shifting and masking.
+//
+// The format attribute makes the compiler check every call's arguments
+// against its format string (-Wformat, part of -Wall).
+#define KFORMAT(fmt_index, first_arg) __attribute__((format(printf, fmt_index, first_arg)))
+
+// --- 64-bit Division ---
+// Divides 'n' by 'd' in place and returns the remainder. Done as two 32-bit
+// divisions (the second one a 64-by-32 divl, which cannot overflow because
+// its high half is already smaller than 'd'), so there is no call to libgcc.
+static inline uint32_t divmod_u64(uint64_t& n, uint32_t d) {
+    uint32_t hi = (uint32_t)(n >> 32);
+    uint32_t lo = (uint32_t)n;
+    uint32_t q_hi = hi / d;
+    uint32_t r = hi % d;
+    uint32_t q_lo;
+    asm("divl %4" : "=a"(q_lo), "=d"(r) : "a"(lo), "d"(r), "rm"(d));
+    n = ((uint64_t)q_hi << 32) | q_lo;
+    return r;
+}
+
+#define KPRINTF_BUFFER_SIZE 256 // Stack buffer; longer output is written in pieces
+
+/**
+ * @brief Writes the digits of 'n' in 'base' (2..16) so that they end right
+ *        before 'end', which needs up to 64 bytes of room in front of it.
+ * @return The first digit. No sign, prefix or terminator is added.
+ */
+char* format_uint(char* end, uint64_t n, unsigned base, bool upper = false);
+
+/**
+ * @brief Formats into 'buf' like vsnprintf: at most size - 1 characters plus
+ *        a terminator.
+ * @return The length the full output would have had (so >= size means it
+ *         was cut off).
+ */
+int kvsnprintf(char* buf, size_t size, const char* fmt, va_list args);
+int ksnprintf(char* buf, size_t size, const char* fmt, ...) KFORMAT(3, 4);
+
+// Prints to the console. Return the number of characters printed.
+int kprintf(const char* fmt, ...) KFORMAT(1, 2);
+int kprintf_color(int color, const char* fmt, ...) KFORMAT(2, 3);
+int kvprintf_color(int color, const char* fmt, va_list args);
+
+#endif // FORMATS_H
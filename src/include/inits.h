@@ -0,0 +1,29 @@
+#ifndef INITS_H
+#define INITS_H
+
+#include <stddef.h> // For size_t
+
+// --- Boot-Only Code and Data ---
+// Functions and variables that are only needed while the kernel boots (ACPI
+// discovery, building the page allocator, ...) are placed in .init.text and
+// .init.data. linker.ld gathers both into one page-aligned block, which
+// free_init_memory() gives to the page allocator once booting is done.
+//
+// Anything marked here must never be used after free_init_memory(): the code
+// and data are overwritten as soon as the pages get reused.
+#define INIT_CODE __attribute__((section(".init.text"), cold))
+#define INIT_DATA __attribute__((section(".init.data")))
+
+// --- Linker Script Symbols ---
+// Page-aligned bounds of the init block. Only their addresses are meaningful.
+extern "C" char init_start[];
+extern "C" char init_end[];
+
+/**
+ * @brief Hands the init block to the page allocator. Call once, after the
+ *        last INIT_CODE function has returned.
+ * @return Number of bytes released (0 if the block is not in managed memory).
+ */
+size_t free_init_memory();
+
+#endif // INITS_H
@@ -0,0 +1,72 @@
+#ifndef INTERRUPTS_H
+#define INTERRUPTS_H
+
+#include <stdint.h> // For uint8_t, uint32_t
+
+// --- Interrupt Setup ---
+// The IDT and the two 8259 PICs. The PICs are remapped so that the 16 legacy
+// IRQ lines arrive on vectors IRQ_BASE..IRQ_BASE + 15, clear of the CPU
+// exceptions (0-31). Every line starts out masked; installing a handler
+// unmasks it. A CPU exception prints a register dump and halts. The entry
+// stubs are in isr_assembly.asm.
+
+#define EXCEPTION_COUNT 32
+#define IRQ_BASE  0x20 // Vector of IRQ 0
+#define IRQ_COUNT 16
+
+// --- IRQ Lines ---
+#define IRQ_TIMER    0
+#define IRQ_KEYBOARD 1
+#define IRQ_CASCADE  2 // The slave PIC; always unmasked
+#define IRQ_COM1     4
+#define IRQ_MOUSE    12
+
+// What exception_common in isr_assembly.asm leaves on the stack: pusha's
+// registers, the stub's vector and error code (0 if the CPU pushed none),
+// then what the CPU pushed.
+struct exception_frame {
+    uint32_t edi, esi, ebp, esp, ebx, edx, ecx, eax; // esp: its value before pusha
+    uint32_t vector;
+    uint32_t error;
+    uint32_t eip, cs, eflags;
+};
+
+// Runs with interrupts disabled. The end-of-interrupt is sent afterwards by
+// the dispatcher, so handlers only have to deal with their device.
+typedef void (*irq_handler)();
+
+/**
+ * @brief Builds the IDT and remaps the PICs with every IRQ masked.
+ *        Interrupts stay disabled until interrupts_enable().
+ */
+void interrupts_init();
+
+/**
+ * @brief Makes 'handler' run for IRQ line 'irq' and unmasks the line.
+ */
+void irq_install_handler(uint8_t irq, irq_handler handler);
+
+void irq_mask(uint8_t irq);
+void irq_unmask(uint8_t irq);
+
+// --- Interrupt Flag ---
+
+static inline void interrupts_enable() {
+    asm volatile("sti" ::: "memory");
+}
+
+// Disables interrupts and returns the previous EFLAGS, for
+// interrupts_restore(). Nests: an inner pair leaves them disabled.
+static inline uint32_t interrupts_save_disable() {
+    uint32_t flags;
+    asm volatile("pushf; pop %0; cli" : "=r"(flags) : : "memory");
+    return flags;
+}
+
+static inline void interrupts_restore(uint32_t flags) {
+    if (flags & (1u << 9)) { // IF was set
+        asm volatile("sti" ::: "memory");
+    }
+}
+
+#endif // INTERRUPTS_H
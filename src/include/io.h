@@ -3,6 +3,7 @@
 
 #include <stdint.h>
 #include "vectors.h" // For vector<char> used in input() and print_vector()
+#include "strings.h" // For string_view
 #include "consts.h"  // For VGA_COLOR_*, VGA_WIDTH, VGA_HEIGHT, KEY_LIMIT, etc.
 
 // --- Extern Global Variable Declarations (these are defined in screen.cpp or consts.cpp) ---
@@ -19,7 +20,7 @@ extern uint16_t cursor_y;             // Defined in screen.cpp
 // Key scancode #defines (like ENTER, BACKSPACE) are directly used from consts.h
 
 // --- Forward declaration for scroll_screen (defined in screen.cpp) ---
-void scroll_screen(volatile uint16_t* buffer); // Or void scroll_screen();
+void scroll_screen();
 
 
 // --- I/O Port Functions (static inline, so definition stays in header) ---
@@ -56,6 +57,10 @@ static inline uint32_t inl(uint16_t port) {
 // --- Character and String Printing Function Declarations ---
 void print_char(char c, bool inplace = false, int color = VGA_COLOR_LIGHT_GREY);
 void print_string(const char* str, int color = VGA_COLOR_LIGHT_GREY);
+void print_string(string_view str, int color = VGA_COLOR_LIGHT_GREY);
+// Prints 'n' characters as one batch: runs of ordinary characters are
+// copied into the screen a line at a time instead of char by char.
+void console_write(const char* text, size_t n, int color = VGA_COLOR_LIGHT_GREY);
 void print_vector(const vector<char>& v, int color = VGA_COLOR_LIGHT_GREY);
 
 void print_uint_base(unsigned long long n, int base, int color, bool print_prefix);
@@ -63,9 +68,18 @@ void print_int(long long n, int color = VGA_COLOR_LIGHT_GREY);
 void print_hex(uint64_t n, int color = VGA_COLOR_LIGHT_GREY);
 void print_hex32(uint32_t n, int color = VGA_COLOR_LIGHT_GREY);
 
+// --- Output Sinks ---
+// Everything printed is also handed, as plain text without colors, to each
+// registered sink (the serial console). Sinks must not print themselves.
+#define CONSOLE_MAX_SINKS 4
+typedef void (*output_sink)(const char* text, size_t n);
+
+// Returns false if all CONSOLE_MAX_SINKS slots are taken.
+bool console_add_sink(output_sink sink);
+
 // --- Keyboard Input Function Declarations ---
 char scancode_to_ascii(uint8_t scancode, bool shift_pressed);
-uint8_t scankey(); // Blocking call to get a scancode
+uint16_t scankey(); // Blocking call to get a key code (keyboards.h); sleeps in hlt while waiting
 void input(vector<char>& v, int color = VGA_COLOR_LIGHT_GREY);
 
 #endif // IO_H
\ No newline at end of file
@@ -0,0 +1,31 @@
+#ifndef KEYBOARDS_H
+#define KEYBOARDS_H
+
+#include <stdint.h> // For uint8_t, uint16_t
+
+// --- PS/2 Keyboard ---
+// The IRQ 1 handler only moves each byte from the controller into a ring
+// buffer; decoding into key codes happens in normal code, when the bytes are
+// read. So waiting for a key costs nothing: the CPU sleeps in 'hlt' until
+// the next interrupt instead of polling port 0x64.
+//
+// Key codes are the set 1 scancodes, with KEY_EXTENDED added for keys sent
+// with an E0 prefix (arrows, Page Up/Down, keypad Enter, right Ctrl/Alt...).
+// Bit 0x80 still marks a release. See consts.h for the names.
+
+#define KEYBOARD_BUFFER_SIZE 64 // Scancode bytes; power of two (ring_buffer)
+#define KEY_NONE 0
+
+// Flushes the controller and installs the IRQ 1 handler. Call after interrupts_init().
+void keyboard_init();
+
+/**
+ * @brief Decodes the next key from the buffered scancode bytes.
+ * @return Its key code, or KEY_NONE if no complete key is waiting.
+ */
+uint16_t keyboard_get_key();
+
+// True if scancode bytes are waiting (possibly only part of a key).
+bool keyboard_has_data();
+
+#endif // KEYBOARDS_H
@@ -0,0 +1,148 @@
+#ifndef LISTS_H
+#define LISTS_H
+
+#include <stdint.h>  // For uintptr_t
+#include "vectors.h" // For size_t
+
+// --- Intrusive Doubly-Linked Lists ---
+// The links live inside the listed objects (a list_node member), so putting
+// an object on a list never allocates, and removing it is O(1) given only the
+// object. One object can sit on several lists at once through several nodes.
+// The list never owns its objects: it does not create, copy or free them.
+//
+//     struct task {
+//         int id;
+//         list_node run_link;
+//     };
+//     intrusive_list<task, &task::run_link> run_queue;
+//
+// The list is a ring through a sentinel node embedded in the list object, so
+// insertions and removals have no null checks. Its constructor is constexpr
+// and it has no destructor, so a global list is set up at compile time.
+
+struct list_node {
+    list_node* prev;
+    list_node* next;
+
+    constexpr list_node() : prev(nullptr), next(nullptr) {}
+
+    // True while the node is on a list
+    bool linked() const { return next != nullptr; }
+
+    list_node(const list_node&) = delete;
+    list_node& operator=(const list_node&) = delete;
+};
+
+template <typename T, list_node T::*Node>
+class intrusive_list {
+private:
+    list_node head; // Sentinel: head.next is the first node, head.prev the last
+    size_t count;
+
+    // The object containing node 'n' (container_of)
+    static T* owner(list_node* n) {
+        // Offset of the node member, measured on a dummy address
+        const uintptr_t base = 0x1000;
+        uintptr_t offset = (uintptr_t)&(reinterpret_cast<T*>(base)->*Node) - base;
+        return reinterpret_cast<T*>(reinterpret_cast<char*>(n) - offset);
+    }
+
+    static void link_between(list_node* n, list_node* before, list_node* after) {
+        n->prev = before;
+        n->next = after;
+        before->next = n;
+        after->prev = n;
+    }
+
+public:
+    class iterator {
+    private:
+        list_node* at;
+
+    public:
+        explicit iterator(list_node* n) : at(n) {}
+        T& operator*() const { return *owner(at); }
+        T* operator->() const { return owner(at); }
+        iterator& operator++() {
+            at = at->next;
+            return *this;
+        }
+        bool operator!=(const iterator& other) const { return at != other.at; }
+        bool operator==(const iterator& other) const { return at == other.at; }
+    };
+
+    constexpr intrusive_list() : head(), count(0) {
+        head.prev = &head;
+        head.next = &head;
+    }
+
+    intrusive_list(const intrusive_list&) = delete;
+    intrusive_list& operator=(const intrusive_list&) = delete;
+
+    bool empty() const { return head.next == &head; }
+    size_t size() const { return count; }
+
+    // nullptr when empty
+    T* front() { return empty() ? nullptr : owner(head.next); }
+    T* back() { return empty() ? nullptr : owner(head.prev); }
+
+    // The object must not be on this list already (its node must be unlinked).
+    void push_front(T* obj) {
+        link_between(&(obj->*Node), &head, head.next);
+        count++;
+    }
+
+    void push_back(T* obj) {
+        link_between(&(obj->*Node), head.prev, &head);
+        count++;
+    }
+
+    // Inserts 'obj' right before 'pos', which must be on this list.
+    void insert_before(T* pos, T* obj) {
+        list_node* p = &(pos->*Node);
+        link_between(&(obj->*Node), p->prev, p);
+        count++;
+    }
+
+    // Unlinks 'obj', which must be on this list.
+    void remove(T* obj) {
+        list_node* n = &(obj->*Node);
+        n->prev->next = n->next;
+        n->next->prev = n->prev;
+        n->prev = nullptr;
+        n->next = nullptr;
+        count--;
+    }
+
+    // Unlinks and returns the first object, or nullptr when empty.
+    T* pop_front() {
+        T* obj = front();
+        if (obj) remove(obj);
+        return obj;
+    }
+
+    T* pop_back() {
+        T* obj = back();
+        if (obj) remove(obj);
+        return obj;
+    }
+
+    // The object after 'obj', or nullptr at the end
+    T* next(T* obj) {
+        list_node* n = (obj->*Node).next;
+        return n == &head ? nullptr : owner(n);
+    }
+
+    // Unlinks every object (the objects themselves are untouched).
+    void clear() {
+        while (pop_front()) {
+        }
+    }
+
+    // Range-for support. Removing the current object invalidates the loop;
+    // walk with next() and remember the successor first to do that.
+    iterator begin() { return iterator(head.next); }
+    iterator end() { return iterator(&head); }
+};
+
+#endif // LISTS_H
@@ -0,0 +1,61 @@
+#ifndef LOGS_H
+#define LOGS_H
+
+#include <stdint.h>  // For uint32_t, uint64_t
+#include "formats.h" // For KFORMAT
+#include "strings.h" // For string_view
+
+// --- Kernel Log ---
+// klog() records a message in a fixed ring of KLOG_RECORDS binary records
+// (level, subsystem, TSC timestamp, formatted text) instead of printing it.
+// Nothing is drawn at that point: klog_drain() later echoes new records at
+// or above the console level to the screen (and so to the serial port), and
+// 'dmesg' prints whatever is still in the ring.
+//
+// Writers claim a record with one atomic increment and never wait or take a
+// lock, so klog() may be called from interrupt handlers, including one that
+// interrupted another klog(). When the ring is full the oldest records are
+// overwritten; readers notice and skip them.
+
+#define KLOG_ERR   0
+#define KLOG_WARN  1
+#define KLOG_INFO  2
+#define KLOG_DEBUG 3
+
+#define KLOG_RECORDS       256 // Power of two
+#define KLOG_TEXT_MAX      108 // Bytes of text per record (a record is 128 bytes)
+#define KLOG_CONSOLE_LEVEL KLOG_INFO // klog_drain() skips anything less important
+
+// --- Time Stamp Counter ---
+static inline uint64_t rdtsc() {
+    uint32_t lo, hi;
+    asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+    return ((uint64_t)hi << 32) | lo;
+}
+
+/**
+ * @brief Measures the TSC rate against the PIT so timestamps can be shown
+ *        in seconds, counted from this call. Call first thing at boot.
+ */
+void klog_init();
+
+/**
+ * @brief Records a message. 'subsystem' must be a string literal (only the
+ *        pointer is stored). A trailing newline in 'fmt' is not needed.
+ */
+void klog(int level, const char* subsystem, const char* fmt, ...) KFORMAT(3, 4);
+
+/**
+ * @brief Prints the records logged since the last call, at KLOG_CONSOLE_LEVEL
+ *        or more important. Call from normal (non-interrupt) code only.
+ */
+void klog_drain();
+
+// Prints every record still in the ring at 'max_level' or more important,
+// with timestamps (the 'dmesg' command).
+void klog_dump(int max_level);
+
+// "err", "warn", "info" or "debug" to KLOG_*; -1 if it is none of them.
+int klog_parse_level(string_view name);
+
+#endif // LOGS_H
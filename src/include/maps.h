@@ -0,0 +1,315 @@
+#ifndef MAPS_H
+#define MAPS_H
+
+#include <stdint.h>  // For uint8_t, uint32_t
+#include "vectors.h" // For size_t, placement new and mem_resource
+#include "strings.h" // For string_view/string keys
+
+// --- Hash Map ---
+// Open addressing with Robin Hood probing: a key lives in its home slot or a
+// few slots after it, and an entry that is further from home than the one in
+// its way takes that slot (the displaced entry moves on). That keeps every
+// probe sequence short, so a lookup reads one small run of neighbouring slots
+// and stops as soon as it meets an entry closer to home than the key would be.
+//
+// The probe distances are kept in their own byte array, apart from the
+// entries, so a miss usually touches a single cache line. Entries store the
+// full 32-bit hash; keys are only compared when the hashes match, and growing
+// the table never hashes a key again.
+//
+// Two modes:
+//   hash_map<K, V>               Grows from a mem_resource (kernel heap by default)
+//   fixed_hash_map<K, V, N>      Inline storage for N entries, never allocates;
+//                                insert() fails once it is full
+// Neither is constant-initialised: use them as locals or members, not globals
+// (boot.asm does not run global constructors).
+
+// --- Key Hashing ---
+// Overloads picked by hash_map. Add one next to any new key type.
+inline uint32_t hash_key(uint32_t x) {
+    // Murmur3 finaliser: every input bit affects the low bits used as index
+    x ^= x >> 16;
+    x *= 0x85ebca6bu;
+    x ^= x >> 13;
+    x *= 0xc2b2ae35u;
+    x ^= x >> 16;
+    return x;
+}
+inline uint32_t hash_key(int x) { return hash_key((uint32_t)x); }
+template <typename T>
+inline uint32_t hash_key(T* p) { return hash_key((uint32_t)(uintptr_t)p); }
+inline uint32_t hash_key(string_view s) { return s.hash(); }
+inline uint32_t hash_key(const string& s) { return s.hash(); }
+
+template <typename K, typename V>
+struct hash_map_entry {
+    uint32_t hash;
+    K key;
+    V value;
+};
+
+template <typename K, typename V>
+class hash_map {
+public:
+    using entry = hash_map_entry<K, V>;
+
+private:
+    uint8_t* dist;     // Per slot: 0 = empty, otherwise probe distance + 1
+    entry* slots;
+    size_t cap;        // Number of slots, a power of two (0 until first use in heap mode)
+    size_t count;
+    mem_resource* res; // nullptr in fixed-capacity mode
+
+    static constexpr uint8_t MAX_DIST = 255;
+
+    size_t mask() const { return cap - 1; }
+
+    // Grow at 7/8 full: Robin Hood keeps probes short well past that, but the
+    // last few free slots make inserts walk long runs.
+    size_t max_load() const { return cap - cap / 8; }
+
+    static size_t block_offset(size_t slot_count) {
+        return (slot_count + alignof(entry) - 1) & ~(alignof(entry) - 1);
+    }
+
+    // Slot holding 'key', or cap if it is not in the map.
+    size_t find_index(const K& key, uint32_t h) const {
+        if (count == 0) return cap;
+        size_t i = h & mask();
+        for (uint32_t d = 1;; ++d) {
+            // An empty slot or an entry closer to its home than 'key' would be
+            // here means 'key' was never inserted (it would have taken the slot).
+            if (dist[i] < d) return cap;
+            if (slots[i].hash == h && slots[i].key == key) return i;
+            i = (i + 1) & mask();
+        }
+    }
+
+    // Robin Hood insertion of an entry whose key is not in the map; ends the
+    // lifetime of 'carry'. Returns the slot where it ended up, or cap if a
+    // probe reached MAX_DIST. Then 'carry' holds whichever entry was being
+    // pushed along at that point, and the caller has to grow and place it
+    // again. That needs at least 255 colliding keys, which neither a fixed map
+    // (at most 256 slots) nor a reasonable hash_key() can produce.
+    size_t place(entry& carry) {
+        size_t i = carry.hash & mask();
+        size_t placed = cap;
+        uint8_t d = 1;
+        while (true) {
+            if (dist[i] == 0) {
+                new (slots + i) entry(static_cast<entry&&>(carry));
+                carry.~entry();
+                dist[i] = d;
+                return placed == cap ? i : placed;
+            }
+            if (dist[i] < d) {
+                // Take from the rich: the resident is closer to home, so it
+                // moves on and the carried entry takes its slot.
+                entry resident(static_cast<entry&&>(slots[i]));
+                slots[i].~entry();
+                new (slots + i) entry(static_cast<entry&&>(carry));
+                carry.~entry();
+                new (&carry) entry(static_cast<entry&&>(resident));
+                uint8_t t = dist[i];
+                dist[i] = d;
+                d = t;
+                if (placed == cap) placed = i;
+            }
+            if (d == MAX_DIST) {
+                return cap;
+            }
+            i = (i + 1) & mask();
+            d++;
+        }
+    }
+
+    // Moves every entry into a table of 'new_cap' slots.
+    bool rehash(size_t new_cap) {
+        size_t offset = block_offset(new_cap);
+        char* block = static_cast<char*>(res->allocate(offset + sizeof(entry) * new_cap, alignof(entry)));
+        if (!block) return false; // OOM: keep the old table
+
+        uint8_t* old_dist = dist;
+        entry* old_slots = slots;
+        size_t old_cap = cap;
+
+        dist = reinterpret_cast<uint8_t*>(block);
+        slots = reinterpret_cast<entry*>(block + offset);
+        cap = new_cap;
+        memset(dist, 0, new_cap);
+
+        for (size_t i = 0; i < old_cap; ++i) {
+            if (old_dist[i]) {
+                place(old_slots[i]); // Ends the old entry's lifetime
+            }
+        }
+        if (old_cap) {
+            res->deallocate(old_dist, block_offset(old_cap) + sizeof(entry) * old_cap, alignof(entry));
+        }
+        return true;
+    }
+
+    bool has_room_for_one_more() {
+        if (count + 1 <= max_load()) return true;
+        if (!res) return false; // Fixed capacity
+        return rehash(cap ? cap * 2 : 16);
+    }
+
+protected:
+    // Fixed-capacity mode over caller-provided storage (see fixed_hash_map)
+    hash_map(uint8_t* dist_storage, entry* slot_storage, size_t slot_count)
+        : dist(dist_storage), slots(slot_storage), cap(slot_count), count(0), res(nullptr) {
+        memset(dist, 0, cap);
+    }
+
+public:
+    hash_map() : dist(nullptr), slots(nullptr), cap(0), count(0), res(heap_resource()) {}
+
+    // The resource must outlive the map.
+    explicit hash_map(mem_resource* resource)
+        : dist(nullptr), slots(nullptr), cap(0), count(0), res(resource) {}
+
+    ~hash_map() {
+        clear();
+        if (res && cap) {
+            res->deallocate(dist, block_offset(cap) + sizeof(entry) * cap, alignof(entry));
+        }
+    }
+
+    hash_map(const hash_map&) = delete;
+    hash_map& operator=(const hash_map&) = delete;
+
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    size_t capacity() const { return cap ? max_load() : 0; }
+
+    V* find(const K& key) {
+        size_t i = find_index(key, hash_key(key));
+        return i == cap ? nullptr : &slots[i].value;
+    }
+
+    const V* find(const K& key) const {
+        size_t i = find_index(key, hash_key(key));
+        return i == cap ? nullptr : &slots[i].value;
+    }
+
+    bool contains(const K& key) const { return find(key) != nullptr; }
+
+    /**
+     * @brief Adds 'key' or overwrites its value if it is already there.
+     * @return The stored value, or nullptr if the map is full (fixed mode) or
+     *         out of memory.
+     */
+    V* insert(const K& key, const V& value) {
+        uint32_t h = hash_key(key);
+        size_t i = find_index(key, h);
+        if (i != cap) {
+            slots[i].value = value;
+            return &slots[i].value;
+        }
+        if (!has_room_for_one_more()) return nullptr;
+
+        // Raw storage: place() ends the carried entry's lifetime itself.
+        alignas(entry) unsigned char carry_buf[sizeof(entry)];
+        entry* carry = new (carry_buf) entry{h, key, value};
+        size_t at = place(*carry);
+        count++;
+        if (at == cap) {
+            // Pathological clustering (heap mode only, see place()): 'carry'
+            // may now hold another entry; a larger table has room for it.
+            if (!rehash(cap * 2) || place(*carry) == cap) {
+                carry->~entry(); // Lost; cannot happen with a sane hash_key()
+                count--;
+                return find(key);
+            }
+            return find(key);
+        }
+        return &slots[at].value;
+    }
+
+    // Removes 'key'. Returns false if it was not there.
+    bool erase(const K& key) {
+        size_t i = find_index(key, hash_key(key));
+        if (i == cap) return false;
+        slots[i].~entry();
+
+        // Backward shift: pull the following entries of the run one slot
+        // closer to home, so no tombstones are needed.
+        size_t j = (i + 1) & mask();
+        while (dist[j] > 1) {
+            new (slots + i) entry(static_cast<entry&&>(slots[j]));
+            slots[j].~entry();
+            dist[i] = dist[j] - 1;
+            i = j;
+            j = (j + 1) & mask();
+        }
+        dist[i] = 0;
+        count--;
+        return true;
+    }
+
+    // Removes every entry, keeping the slots.
+    void clear() {
+        for (size_t i = 0; i < cap; ++i) {
+            if (dist[i]) {
+                slots[i].~entry();
+                dist[i] = 0;
+            }
+        }
+        count = 0;
+    }
+
+    // Makes room for 'n' entries up front (heap mode only).
+    bool reserve(size_t n) {
+        if (n <= capacity()) return true;
+        if (!res) return false;
+        size_t new_cap = cap ? cap : 16;
+        while (new_cap - new_cap / 8 < n) new_cap *= 2;
+        return rehash(new_cap);
+    }
+
+    // Calls f(key, value) for every entry, in slot order. The map must not be
+    // modified from inside f.
+    template <typename F>
+    void for_each(F f) {
+        for (size_t i = 0; i < cap; ++i) {
+            if (dist[i]) f(static_cast<const K&>(slots[i].key), slots[i].value);
+        }
+    }
+};
+
+// --- Fixed-Capacity Hash Map ---
+// Slots for N entries (plus the 1/8 headroom) stored inline, so the map
+// works before the heap exists and never fails by running out of memory.
+// Like small_vector, the storage is a base class so it exists before the
+// hash_map base is constructed over it.
+
+constexpr size_t hash_map_slots_for(size_t entries) {
+    size_t slots = 16;
+    while (slots - slots / 8 < entries) slots *= 2;
+    return slots;
+}
+
+template <typename K, typename V, size_t N>
+struct fixed_hash_map_storage {
+    static constexpr size_t SLOTS = hash_map_slots_for(N);
+    // With at most 256 slots no probe can get longer than MAX_DIST.
+    static_assert(SLOTS <= 256, "fixed_hash_map holds at most 224 entries");
+
+    uint8_t dist[SLOTS];
+    alignas(hash_map_entry<K, V>) unsigned char slots[sizeof(hash_map_entry<K, V>) * SLOTS];
+};
+
+template <typename K, typename V, size_t N>
+class fixed_hash_map : private fixed_hash_map_storage<K, V, N>, public hash_map<K, V> {
+private:
+    using storage = fixed_hash_map_storage<K, V, N>;
+
+public:
+    fixed_hash_map()
+        : hash_map<K, V>(static_cast<storage*>(this)->dist,
+                         reinterpret_cast<hash_map_entry<K, V>*>(static_cast<storage*>(this)->slots),
+                         storage::SLOTS) {}
+};
+
+#endif // MAPS_H
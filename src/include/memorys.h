@@ -5,11 +5,109 @@
 #include <stdint.h> // For uint32_t, uint64_t, etc.
 
 // --- Custom Memory Allocator Declarations ---
-// Declare the memory pool and index as extern.
-// The size of the pool can be a const extern if needed elsewhere,
-// or just managed within memorys.cpp.
-extern char memory_pool[]; // Actual size defined in .cpp
-extern size_t pool_index;
+// Fallback memory for the page allocator when there is no usable memory map.
+#define MEMORY_POOL_BYTES (1024 * 1024)
+extern char memory_pool[MEMORY_POOL_BYTES];
+
+// Kernel heap (slab allocator backed by the page allocator, see memorys.cpp).
+// kmalloc() returns 16-byte aligned memory, or nullptr when out of memory.
+// kfree() accepts nullptr and ignores pointers it did not hand out.
+void* kmalloc(size_t size);
+void kfree(void* ptr);
+
+// Like kmalloc(), but the memory is zeroed. Large allocations use pages
+// cleared ahead of time by the idle loop (see pages_zero_idle()).
+void* kzalloc(size_t size);
+
+// Over-aligned allocations. 'align' must be a power of two. Alignments up to
+// 16 are served by kmalloc(); page alignment and above come straight from the
+// page allocator. Memory must be released with kfree_aligned() and the same
+// alignment.
+void* kmalloc_aligned(size_t size, size_t align);
+void kfree_aligned(void* ptr, size_t align);
+
+// Tries to make an allocation at least 'new_size' bytes large without moving
+// it: small objects can use the slack of their size class, large blocks take
+// over free neighbouring pages. Returns false (and changes nothing) if that
+// is not possible; the caller then has to allocate, copy and free as usual.
+bool kexpand(void* ptr, size_t new_size);
+bool kexpand_aligned(void* ptr, size_t new_size, size_t align);
+
+// --- Memory Resources ---
+// Where a container gets its memory from. The base class is the kernel heap;
+// arenas (arenas.h) override it. Containers keep a pointer to their resource,
+// so one vector<T> type works with any of them.
+class mem_resource {
+public:
+    constexpr mem_resource() {}
+
+    virtual void* allocate(size_t bytes, size_t align);
+    virtual void deallocate(void* ptr, size_t bytes, size_t align);
+
+    // Grows the allocation at 'ptr' to 'new_bytes' in place, if possible.
+    // Returning false is always allowed.
+    virtual bool try_expand(void* ptr, size_t new_bytes, size_t align);
+
+    // Resources that give memory away on deallocate() can have their blocks
+    // adopted by another container on move. Containers ask before stealing.
+    virtual bool is_equal(const mem_resource* other) const { return this == other; }
+
+    // False for resources that live inside the container using them (the
+    // inline buffer of a small_vector): their blocks must never be handed to
+    // another container, not even on move construction.
+    virtual bool is_portable() const { return true; }
+};
+
+// The default resource: kmalloc_aligned()/kfree_aligned().
+mem_resource* heap_resource();
+
+// --- Heap Statistics ---
+// "Allocated" sizes are what the heap actually handed out (the size class, or
+// the whole page block), so allocated - requested is internal fragmentation.
+struct heap_stats
+{
+    size_t bytes_in_use;      // Allocated bytes currently live
+    size_t peak_bytes;        // High-water mark of bytes_in_use
+    uint64_t requested_bytes; // Lifetime total asked for by callers
+    uint64_t allocated_bytes; // Lifetime total handed out
+    uint32_t alloc_count;
+    uint32_t free_count;
+    uint32_t failed_count;    // Allocations that returned nullptr
+    uint32_t large_active;    // Live allocations on the page-block path
+    size_t slab_pages;        // Pages owned by slabs (filled in by heap_get_stats)
+    size_t slab_free_bytes;   // Unused object space inside those slabs
+};
+
+struct heap_cache_stats
+{
+    const char* name;
+    size_t object_size;
+    uint32_t active;          // Objects currently handed out
+    uint32_t allocs;
+    uint32_t frees;
+    uint32_t slabs;
+};
+
+struct heap_site_stats
+{
+    void* site;               // Return address of the allocating call
+    uint32_t allocs;
+    size_t bytes;             // Lifetime bytes allocated from this site
+};
+
+void heap_get_stats(heap_stats* out);
+// Size classes come first, then caches from kmem_cache_create(). Returns false past the last one.
+bool heap_get_cache_stats(int index, heap_cache_stats* out);
+// Fills 'out' with up to 'max' call sites, largest lifetime bytes first. Returns the count.
+int heap_get_top_sites(heap_site_stats* out, int max);
+// Allocations whose call site did not fit in the site table.
+uint32_t heap_dropped_sites();
+
+// There is no <new> in this freestanding build, so the alignment tag type that
+// the compiler passes to aligned operator new is declared here.
+namespace std {
+    enum class align_val_t : size_t {};
+}
 
 // Declare operator new[] and delete[]
 // The 'noexcept' specifier is important for delete operators and
@@ -21,9 +119,29 @@ extern size_t pool_index;
 void* operator new[](size_t size) noexcept;
 void operator delete[](void* ptr) noexcept;
 
-// Consider adding a non-array version if you'll use `new MyType;`
-// void* operator new(size_t size) noexcept;
-// void operator delete(void* ptr) noexcept;
+// Scalar versions, so driver objects can be created with `new MyType`.
+void* operator new(size_t size) noexcept;
+void operator delete(void* ptr) noexcept;
+
+// Sized deletes are what the compiler calls in C++14 and later when the size is known.
+void operator delete(void* ptr, size_t size) noexcept;
+void operator delete[](void* ptr, size_t size) noexcept;
+
+// Over-aligned types (alignas(N) with N > 16) are routed here by the compiler.
+void* operator new(size_t size, std::align_val_t align) noexcept;
+void* operator new[](size_t size, std::align_val_t align) noexcept;
+void operator delete(void* ptr, std::align_val_t align) noexcept;
+void operator delete[](void* ptr, std::align_val_t align) noexcept;
+void operator delete(void* ptr, size_t size, std::align_val_t align) noexcept;
+void operator delete[](void* ptr, size_t size, std::align_val_t align) noexcept;
+
+// --- Freestanding Memory Primitives ---
+// GCC may emit calls to these even with -ffreestanding (struct copies, loops
+// it recognises as fills), so they must exist under their C names.
+extern "C" void* memset(void* dest, int value, size_t count);
+extern "C" void* memcpy(void* dest, const void* src, size_t count);
+extern "C" void* memmove(void* dest, const void* src, size_t count);
+extern "C" int memcmp(const void* ptr1, const void* ptr2, size_t count);
 
 
 // --- Multiboot Structures ---
@@ -82,6 +200,15 @@ struct mmap_entry
     uint32_t type;     // Type of memory region (1 = available, other values = reserved/ACPI/etc.)
 } __attribute__((packed)); // Ensure no padding
 
+// Boot module entry (array at mbi->mods_addr, valid if bit 3 of flags is set)
+struct multiboot_module
+{
+    uint32_t mod_start; // Physical start address of the module
+    uint32_t mod_end;   // Physical end address (exclusive)
+    uint32_t string;    // Physical address of the module's command line
+    uint32_t reserved;
+};
+
 // --- External Variable from Bootloader ---
 // This tells the C++ code that a symbol named mboot_info_ptr is defined elsewhere (likely boot.asm).
 extern "C" uint32_t mboot_info_ptr;
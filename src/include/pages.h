@@ -0,0 +1,102 @@
+#ifndef PAGES_H
+#define PAGES_H
+
+#include <stddef.h> // For size_t
+#include <stdint.h> // For uint32_t, uintptr_t
+
+#include "memorys.h" // For multiboot_info
+
+// --- Physical Page Allocator ---
+// A binary buddy allocator over 4 KiB frames. It is seeded from the type-1
+// (available) regions of the multiboot memory map, minus the kernel image and
+// the multiboot structures. Blocks are 2^order contiguous frames and are
+// coalesced with their buddy on free.
+// Paging is not enabled, so the returned addresses are both physical and
+// directly usable as pointers.
+
+#define PAGE_SIZE      4096
+#define PAGE_SHIFT     12
+#define PAGE_MAX_ORDER 10   // Largest block: 2^10 frames = 4 MiB
+
+// --- Linker Script Symbols ---
+// Defined in linker.ld. Only their addresses are meaningful.
+extern "C" char kernel_start[];
+extern "C" char kernel_end[];
+
+/**
+ * @brief Builds the free lists from the multiboot memory map.
+ *        Must be called once, before the first heap allocation.
+ *        Boot-only code (see inits.h).
+ *        If no memory map is available, the static memory_pool is managed
+ *        instead so the heap still works.
+ * @param mbi Multiboot info passed by the bootloader (may be nullptr).
+ */
+void pages_init(multiboot_info* mbi);
+
+/**
+ * @brief Allocates a block of 2^order contiguous, page-aligned frames.
+ *        When the free lists cannot serve it, the pre-zeroed pool is used
+ *        up before giving up.
+ * @return Address of the block, or nullptr if no block is large enough.
+ */
+void* pages_alloc(unsigned int order);
+
+/**
+ * @brief Returns a block obtained from pages_alloc() to the allocator.
+ *        The order is looked up from the frame metadata, and the block is
+ *        merged with its free buddies as far as possible.
+ */
+void pages_free(void* addr);
+
+/**
+ * @brief Smallest order whose block holds at least 'bytes' bytes.
+ * @return The order, or PAGE_MAX_ORDER + 1 if the request is too large.
+ */
+unsigned int pages_order_for(size_t bytes);
+
+// --- Pre-Zeroed Pages ---
+// A small pool of single pages that were cleared ahead of time, while the
+// kernel had nothing else to do. Zeroed allocations take from it first, so
+// the clearing cost is off the hot path.
+
+#define ZERO_POOL_PAGES 32 // Pool capacity (128 KiB)
+#define ZERO_IDLE_BATCH 1  // Pages cleared per pages_zero_idle() call
+
+/**
+ * @brief Like pages_alloc(), but the block is filled with zeroes. Single
+ *        pages come from the pre-zeroed pool when it is not empty.
+ */
+void* pages_alloc_zeroed(unsigned int order);
+
+/**
+ * @brief Idle hook: tops up the pre-zeroed pool by up to ZERO_IDLE_BATCH
+ *        pages. Cheap when the pool is already full. Call from wait loops.
+ * @return true if it cleared a page (there may be more to do), false once
+ *         there is nothing left and the caller can go to sleep.
+ */
+bool pages_zero_idle();
+
+size_t pages_zeroed_count(); // Pages currently waiting in the pool
+
+/**
+ * @brief Grows an allocated block in place to 'new_order' by taking over the
+ *        free buddy blocks that follow it. Nothing moves, so the contents and
+ *        the address stay valid.
+ * @return true if the block now has order 'new_order' (or already had it);
+ *         false if a following buddy is in use or split, in which case
+ *         nothing was changed.
+ */
+bool pages_expand(void* addr, unsigned int new_order);
+
+// --- Statistics ---
+size_t pages_total_count(); // Frames handed to the allocator at init
+size_t pages_free_count();  // Frames currently on the free lists
+int pages_largest_free_order(); // Order of the largest free block, -1 if none
+
+/**
+ * @brief Order of an allocated block, looked up from the frame metadata.
+ * @return The order, or -1 if 'addr' is not the start of an allocated block.
+ */
+int pages_order_of(void* addr);
+
+#endif // PAGES_H
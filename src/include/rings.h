@@ -0,0 +1,89 @@
+#ifndef RINGS_H
+#define RINGS_H
+
+#include <stdint.h>  // For uint32_t
+#include "vectors.h" // For size_t
+
+// --- Ring Buffer ---
+// A fixed-size FIFO queue for passing items from one producer to one consumer,
+// typically an interrupt handler to the main loop (keystrokes, received
+// bytes) or the other way round (bytes waiting to be sent). It never
+// allocates, and neither side ever has to disable interrupts:
+//   - only the producer writes 'head', only the consumer writes 'tail';
+//   - an item is fully written before 'head' is published (release), and the
+//     consumer reads 'head' before it reads the item (acquire).
+// With more than one producer or consumer, callers must serialise them.
+//
+// N must be a power of two: the indices run freely and wrap naturally, and
+// the slot is index & (N - 1). Items are copied in and out once, so T must be
+// trivially copyable (a scancode, a char, a small event struct).
+// The constructor is constexpr, so a global ring needs no runtime setup.
+
+template <typename T, size_t N>
+class ring_buffer {
+private:
+    static_assert(N > 0 && (N & (N - 1)) == 0, "ring_buffer size must be a power of two");
+    static_assert(__is_trivially_copyable(T), "ring_buffer items must be trivially copyable");
+
+    T items[N];
+    uint32_t head; // Items ever pushed (written by the producer only)
+    uint32_t tail; // Items ever popped (written by the consumer only)
+
+public:
+    constexpr ring_buffer() : items{}, head(0), tail(0) {}
+
+    ring_buffer(const ring_buffer&) = delete;
+    ring_buffer& operator=(const ring_buffer&) = delete;
+
+    static constexpr size_t capacity() { return N; }
+
+    // A snapshot: the other side may change it at any moment.
+    size_t size() const {
+        return __atomic_load_n(&head, __ATOMIC_ACQUIRE) - __atomic_load_n(&tail, __ATOMIC_ACQUIRE);
+    }
+    bool empty() const { return size() == 0; }
+    bool full() const { return size() == N; }
+
+    // --- Producer side ---
+
+    // Returns false (dropping 'item') when the ring is full.
+    bool push(const T& item) {
+        uint32_t h = head;
+        if (h - __atomic_load_n(&tail, __ATOMIC_ACQUIRE) == N) {
+            return false;
+        }
+        items[h & (N - 1)] = item;
+        __atomic_store_n(&head, h + 1, __ATOMIC_RELEASE);
+        return true;
+    }
+
+    // --- Consumer side ---
+
+    // Returns false when the ring is empty.
+    bool pop(T& out) {
+        uint32_t t = tail;
+        if (__atomic_load_n(&head, __ATOMIC_ACQUIRE) == t) {
+            return false;
+        }
+        out = items[t & (N - 1)];
+        __atomic_store_n(&tail, t + 1, __ATOMIC_RELEASE);
+        return true;
+    }
+
+    // Copies the oldest item without removing it. Returns false when empty.
+    bool peek(T& out) const {
+        uint32_t t = tail;
+        if (__atomic_load_n(&head, __ATOMIC_ACQUIRE) == t) {
+            return false;
+        }
+        out = items[t & (N - 1)];
+        return true;
+    }
+
+    // Drops everything pushed so far.
+    void clear() {
+        __atomic_store_n(&tail, __atomic_load_n(&head, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+    }
+};
+
+#endif // RINGS_H
@@ -3,29 +3,69 @@
 
 #include <stdint.h> // For uint16_t
 
+// --- Screen Size ---
+// Compile-time copies of VGA_WIDTH/VGA_HEIGHT (consts.cpp), for array sizes.
+#define SCREEN_COLS 80
+#define SCREEN_ROWS 25
+
+#define SCROLLBACK_LINES 200 // Lines kept after they scroll off the top
+
 // --- Screen Global Variable Declarations ---
 // Declare these as 'extern'. Their definitions will be in screen.cpp.
 // 'volatile' is important for vga_buffer as it's memory-mapped I/O.
+// Only screen_flush() writes to it (at the hardware scroll offset); everything
+// else goes through screen_put().
 extern volatile uint16_t* vga_buffer;
 extern uint16_t cursor_x;
 extern uint16_t cursor_y;
 
 // --- Screen Function Declarations ---
 // Only declare the functions here. Definitions go in screen.cpp.
+//
+// Output is drawn into a shadow copy of the screen in normal RAM and reaches
+// VRAM when screen_flush() is called. Input routines flush before they wait
+// for a key; anything that halts or busy-waits must flush first, or its last
+// messages stay invisible.
+
+/**
+ * @brief Sets the cell (character | color << 8) at x, y in the shadow screen.
+ */
+void screen_put(uint16_t x, uint16_t y, uint16_t cell);
+
+uint16_t screen_get(uint16_t x, uint16_t y);
+
+/**
+ * @brief Writes 'n' characters in one color starting at x, y, all on that
+ *        line (anything past its end is dropped). Control characters are not
+ *        interpreted; console_write() does that.
+ */
+void screen_write(uint16_t x, uint16_t y, const char* text, uint32_t n, int color);
+
+/**
+ * @brief Copies the lines changed since the last flush to VRAM and moves the
+ *        hardware cursor to cursor_x/cursor_y (if either changed).
+ */
+void screen_flush();
+
+/**
+ * @brief Moves the viewport 'lines' further back into the scrollback
+ *        (negative: towards the live screen). Takes effect on the next flush.
+ */
+void screen_view_scroll(int lines);
+
+// Shows the live screen again (called when new output is printed).
+void screen_view_live();
 
 /**
  * @brief Clears the entire VGA text screen and resets the cursor.
+ *        The scrollback is kept.
  */
 void cls();
 
 /**
  * @brief Scrolls the screen content up by one line.
- *        The bottom-most line is cleared.
- * @param buffer_to_scroll Pointer to the VGA buffer to operate on.
- *                         Typically, this will be the global vga_buffer.
+ *        The top line goes to the scrollback, the bottom-most line is cleared.
  */
-void scroll_screen(volatile uint16_t* buffer_to_scroll);
-// Alternatively, if scroll_screen always operates on the global vga_buffer:
-// void scroll_screen(); // And the implementation in screen.cpp would use the global.
+void scroll_screen();
 
-#endif // SCREENS_H
\ No newline at end of file
+#endif // SCREENS_H
@@ -0,0 +1,34 @@
+#ifndef SERIALS_H
+#define SERIALS_H
+
+#include <stdint.h>  // For uint16_t
+#include "vectors.h" // For size_t
+
+// --- Serial Console ---
+// A copy of all console output on COM1 (115200 baud, 8N1), e.g. for
+// 'qemu -serial stdio' or a headless test run.
+//
+// Writes only queue the bytes in a ring buffer and return. The UART's
+// "transmitter empty" interrupt (IRQ 4) then moves them into its 16-byte
+// FIFO, a FIFO-full at a time, so printing never waits for the line.
+// Only when the ring is full does a write send bytes itself to make room.
+
+#define COM1_PORT 0x3F8
+#define SERIAL_TX_BUFFER_SIZE 4096 // Power of two (ring_buffer)
+
+/**
+ * @brief Sets up COM1 and registers it as a console output sink.
+ *        Call after interrupts_init(); output printed before is not sent.
+ */
+void serial_init();
+
+// Queues 'n' bytes for sending, with '\n' sent as "\r\n".
+void serial_write(const char* text, size_t n);
+
+/**
+ * @brief Sends everything queued by polling the UART. For when interrupts
+ *        are (or are about to be) disabled for good: halts, reboots.
+ */
+void serial_flush();
+
+#endif // SERIALS_H
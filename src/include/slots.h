@@ -0,0 +1,119 @@
+#ifndef SLOTS_H
+#define SLOTS_H
+
+#include <stdint.h>  // For uint16_t, uint32_t
+#include "vectors.h" // For size_t
+
+// --- Slot Map ---
+// N fixed slots with a bitmap of which are in use, for objects that are
+// created and destroyed at run time but must not come from the heap (open
+// devices, timers, handles given to drivers). Finding a free slot scans the
+// bitmap a word at a time, so it costs one instruction per 32 slots.
+//
+// Objects are referred to by a slot_handle: the slot index plus the slot's
+// generation, which changes every time the slot is reused. A handle kept
+// after its object was erased is detected (get() returns nullptr) instead of
+// silently reaching whatever took the slot next.
+//
+// T must be trivially copyable; slots are plain storage. The constructor is
+// constexpr, so a global slot_map needs no runtime setup.
+
+typedef uint32_t slot_handle; // generation << 16 | index
+#define SLOT_NONE ((slot_handle)0) // Never a valid handle (generations start at 1)
+
+template <typename T, size_t N>
+class slot_map {
+private:
+    static_assert(N > 0 && N <= 65536, "slot_map indices are 16 bits");
+    static_assert(__is_trivially_copyable(T), "slot_map items must be trivially copyable");
+
+    static constexpr size_t WORDS = (N + 31) / 32;
+
+    T items[N];
+    uint16_t generation[N]; // Generation of the current (or last) occupant
+    uint32_t used[WORDS];   // Bit i set: slot i is occupied
+    size_t count;
+
+    static uint32_t index_of(slot_handle h) { return h & 0xFFFF; }
+    static uint16_t generation_of(slot_handle h) { return (uint16_t)(h >> 16); }
+
+    bool is_used(uint32_t index) const {
+        return used[index / 32] & (1u << (index % 32));
+    }
+
+    // Index of the slot 'h' refers to, or N if the handle is stale or invalid
+    uint32_t resolve(slot_handle h) const {
+        uint32_t index = index_of(h);
+        if (index >= N || !is_used(index) || generation[index] != generation_of(h)) {
+            return N;
+        }
+        return index;
+    }
+
+public:
+    constexpr slot_map() : items{}, generation{}, used{}, count(0) {}
+
+    slot_map(const slot_map&) = delete;
+    slot_map& operator=(const slot_map&) = delete;
+
+    size_t size() const { return count; }
+    static constexpr size_t capacity() { return N; }
+    bool full() const { return count == N; }
+
+    /**
+     * @brief Stores a copy of 'value' in a free slot.
+     * @return Its handle, or SLOT_NONE if every slot is taken.
+     */
+    slot_handle insert(const T& value) {
+        for (size_t w = 0; w < WORDS; ++w) {
+            uint32_t free_bits = ~used[w];
+            if (!free_bits) continue;
+            uint32_t index = w * 32 + __builtin_ctz(free_bits);
+            if (index >= N) break; // Only the padding bits of the last word were free
+
+            used[w] |= 1u << (index % 32);
+            uint16_t gen = generation[index] + 1;
+            if (gen == 0) gen = 1; // Keep SLOT_NONE invalid after wrap-around
+            generation[index] = gen;
+            items[index] = value;
+            count++;
+            return ((slot_handle)gen << 16) | index;
+        }
+        return SLOT_NONE;
+    }
+
+    // The object for 'h', or nullptr if it was erased (or 'h' is SLOT_NONE)
+    T* get(slot_handle h) {
+        uint32_t index = resolve(h);
+        return index == N ? nullptr : &items[index];
+    }
+
+    const T* get(slot_handle h) const {
+        uint32_t index = resolve(h);
+        return index == N ? nullptr : &items[index];
+    }
+
+    // Frees the slot. Returns false if 'h' was already stale.
+    bool erase(slot_handle h) {
+        uint32_t index = resolve(h);
+        if (index == N) return false;
+        used[index / 32] &= ~(1u << (index % 32));
+        count--;
+        return true;
+    }
+
+    // Calls f(handle, item) for every occupied slot, in slot order.
+    template <typename F>
+    void for_each(F f) {
+        for (size_t w = 0; w < WORDS; ++w) {
+            uint32_t bits = used[w];
+            while (bits) {
+                uint32_t index = w * 32 + __builtin_ctz(bits);
+                bits &= bits - 1; // Clear the lowest set bit
+                f(((slot_handle)generation[index] << 16) | index, items[index]);
+            }
+        }
+    }
+};
+
+#endif // SLOTS_H
@@ -0,0 +1,52 @@
+#ifndef STACKS_H
+#define STACKS_H
+
+#include <stddef.h> // For size_t
+#include <stdint.h> // For uint32_t, uintptr_t
+
+// --- Stack Usage Profiler ---
+// Stacks are filled with STACK_PAINT before they are used. Stacks grow down,
+// so scanning up from the bottom for the first word that no longer holds the
+// pattern finds the deepest point the stack has ever reached (the high-water
+// mark). That tells how much headroom each stack really has.
+// A function that reserves a buffer without writing all of it can skip over
+// painted words, so the mark can be slightly low; leave some margin.
+
+#define STACK_PAINT 0x57AC57AC // Must match STACK_PAINT in boot.asm
+#define MAX_STACKS  8
+
+// --- Linker/Assembly Symbols ---
+// The boot stack from boot.asm (painted there before first use).
+extern "C" char stack_bottom[];
+extern "C" char stack_top[];
+
+struct stack_usage {
+    const char* name;
+    size_t size;      // Total bytes
+    size_t peak_used; // High-water mark in bytes
+    size_t used;      // Bytes in use right now if this is the current stack, else 0
+};
+
+/**
+ * @brief Fills [bottom, top) with STACK_PAINT. Call for a new stack before
+ *        switching to it (never for the stack currently in use).
+ */
+void stack_paint(void* bottom, void* top);
+
+/**
+ * @brief Adds a painted stack to the profiler. The boot stack is registered
+ *        from the start.
+ * @param name Label for reports. Must stay valid (use a literal).
+ * @return false if the registry is full.
+ */
+bool stack_register(const char* name, void* bottom, void* top);
+
+int stack_count();
+
+/**
+ * @brief Scans stack 'index' and fills 'out' with its usage.
+ * @return false if there is no such stack.
+ */
+bool stack_get_usage(int index, stack_usage* out);
+
+#endif // STACKS_H
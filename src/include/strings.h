@@ -0,0 +1,187 @@
+#ifndef STRINGS_H
+#define STRINGS_H
+
+#include <stdint.h>  // For uint32_t
+#include "vectors.h" // For size_t, vector<char> and mem_resource
+
+// --- Kernel Strings ---
+// string_view is a pointer and a length into characters owned by someone else
+// (a literal, the shell input buffer, a string). The length is known from the
+// start, so comparisons check it before looking at any byte, and a view of a
+// literal is built at compile time. string owns its characters and keeps them
+// NUL-terminated for code that wants a C string.
+//
+// Both can hash their contents (FNV-1a). For a constexpr view of a literal the
+// hash is computed by the compiler; a string remembers its hash until it is
+// modified. Lookup tables can then compare hashes before comparing bytes.
+
+constexpr size_t str_length(const char* s) {
+    size_t n = 0;
+    while (s[n] != '\0') {
+        n++;
+    }
+    return n;
+}
+
+#define STR_HASH_SEED  2166136261u // FNV-1a offset basis
+#define STR_HASH_PRIME 16777619u
+
+constexpr uint32_t str_hash(const char* s, size_t len) {
+    uint32_t h = STR_HASH_SEED;
+    for (size_t i = 0; i < len; ++i) {
+        h ^= (uint8_t)s[i];
+        h *= STR_HASH_PRIME;
+    }
+    return h;
+}
+
+class string_view {
+private:
+    const char* ptr;
+    size_t len;
+
+    static constexpr bool is_space(char c) {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+public:
+    static constexpr size_t npos = (size_t)-1;
+
+    constexpr string_view() : ptr(""), len(0) {}
+    constexpr string_view(const char* s, size_t n) : ptr(s), len(n) {}
+    constexpr string_view(const char* c_str) : ptr(c_str), len(str_length(c_str)) {}
+    string_view(const vector<char>& v) : ptr(v.data()), len(v.size()) {}
+
+    constexpr const char* data() const { return ptr; }
+    constexpr size_t size() const { return len; }
+    constexpr bool empty() const { return len == 0; }
+    constexpr char operator[](size_t i) const { return ptr[i]; }
+    constexpr const char* begin() const { return ptr; }
+    constexpr const char* end() const { return ptr + len; }
+
+    constexpr uint32_t hash() const { return str_hash(ptr, len); }
+
+    constexpr bool equals(string_view other) const {
+        if (len != other.len) return false;
+        for (size_t i = 0; i < len; ++i) {
+            if (ptr[i] != other.ptr[i]) return false;
+        }
+        return true;
+    }
+
+    constexpr bool starts_with(string_view prefix) const {
+        return len >= prefix.len && string_view(ptr, prefix.len).equals(prefix);
+    }
+
+    constexpr bool ends_with(string_view suffix) const {
+        return len >= suffix.len && string_view(ptr + len - suffix.len, suffix.len).equals(suffix);
+    }
+
+    // Index of the first 'c' at or after 'from', or npos
+    constexpr size_t find(char c, size_t from = 0) const {
+        for (size_t i = from; i < len; ++i) {
+            if (ptr[i] == c) return i;
+        }
+        return npos;
+    }
+
+    // Index of the first occurrence of 'needle' at or after 'from', or npos
+    constexpr size_t find(string_view needle, size_t from = 0) const {
+        if (needle.len > len) return npos;
+        for (size_t i = from; i + needle.len <= len; ++i) {
+            if (string_view(ptr + i, needle.len).equals(needle)) return i;
+        }
+        return npos;
+    }
+
+    // Up to 'n' characters starting at 'pos' (clamped to the end)
+    constexpr string_view substr(size_t pos, size_t n = npos) const {
+        if (pos > len) pos = len;
+        if (n > len - pos) n = len - pos;
+        return string_view(ptr + pos, n);
+    }
+
+    constexpr string_view trim_left() const {
+        size_t i = 0;
+        while (i < len && is_space(ptr[i])) i++;
+        return string_view(ptr + i, len - i);
+    }
+
+    constexpr string_view trim_right() const {
+        size_t n = len;
+        while (n > 0 && is_space(ptr[n - 1])) n--;
+        return string_view(ptr, n);
+    }
+
+    constexpr string_view trim() const { return trim_left().trim_right(); }
+
+    // Splits off everything before the first 'sep' and returns it; the view
+    // keeps what follows the separator. Without a separator the whole view is
+    // returned and the view becomes empty. Repeated calls walk a list:
+    //     while (!args.empty()) { string_view arg = args.split(' '); ... }
+    constexpr string_view split(char sep) {
+        size_t at = find(sep);
+        string_view head = substr(0, at);
+        *this = (at == npos) ? string_view(ptr + len, 0) : substr(at + 1);
+        return head;
+    }
+
+    // Like split(' '), but skips runs of whitespace around the word
+    constexpr string_view next_word() {
+        *this = trim_left();
+        size_t i = 0;
+        while (i < len && !is_space(ptr[i])) i++;
+        string_view word(ptr, i);
+        *this = string_view(ptr + i, len - i).trim_left();
+        return word;
+    }
+};
+
+constexpr bool operator==(string_view a, string_view b) { return a.equals(b); }
+constexpr bool operator!=(string_view a, string_view b) { return !a.equals(b); }
+
+class string {
+private:
+    vector<char> chars;          // The characters plus a trailing NUL once anything is stored
+    mutable uint32_t cached_hash;
+    mutable bool hash_valid;
+
+    void changed() { hash_valid = false; }
+    bool aliases(string_view s) const;
+
+public:
+    string() : cached_hash(0), hash_valid(false) {}
+    explicit string(mem_resource* resource) : chars(resource), cached_hash(0), hash_valid(false) {}
+    string(string_view s) : cached_hash(0), hash_valid(false) { append(s); }
+    string(string_view s, mem_resource* resource) : chars(resource), cached_hash(0), hash_valid(false) {
+        append(s);
+    }
+
+    size_t size() const { return chars.empty() ? 0 : chars.size() - 1; }
+    bool empty() const { return size() == 0; }
+    const char* data() const { return c_str(); }
+    const char* c_str() const { return chars.empty() ? "" : chars.data(); }
+    char operator[](size_t i) const { return chars[i]; }
+
+    string_view view() const { return string_view(c_str(), size()); }
+    operator string_view() const { return view(); }
+
+    // Computed on first use and kept until the string changes
+    uint32_t hash() const;
+
+    bool append(string_view s);
+    bool push_back(char c) { return append(string_view(&c, 1)); }
+    void pop_back();
+    void clear();
+    string& operator=(string_view s);
+};
+
+// Boot-time check that a string can be appended to and assigned from views
+// of itself. Logs an error if not; call once the heap works.
+void strings_self_check();
+
+// Same length and hash first; the bytes are only compared when both match.
+bool operator==(const string& a, const string& b);
+inline bool operator!=(const string& a, const string& b) { return !(a == b); }
+
+#endif // STRINGS_H
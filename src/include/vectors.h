@@ -12,6 +12,8 @@ using size_t = unsigned int; // Or unsigned long, etc.
 inline void* operator new(size_t, void* p) noexcept { return p; }
 inline void operator delete(void*, void*) noexcept {}
 
+#include "memorys.h" // For mem_resource and heap_resource()
+
 // Forward declaration for potential use within vector if T is vector itself (not strictly necessary here)
 // template <typename U> class vector;
 
@@ -21,6 +23,7 @@ private:
     T* arr;              // Pointer to the dynamic array of T objects
     size_t current_size; // Number of elements currently constructed and stored
     size_t cap;          // Total allocated capacity (in terms of number of T elements)
+    mem_resource* res;   // Where the array is allocated from (kernel heap by default)
 
     // Helper function to destroy all constructed elements in the range [first, last)
     void destroy_elements_range(T* first, T* last) {
@@ -34,40 +37,115 @@ private:
         destroy_elements_range(arr, arr + current_size);
     }
 
-    // Helper to allocate raw memory
-    // Returns nullptr on failure if the underlying global new[] returns nullptr
+    // Helper to allocate raw memory from the vector's resource
+    // Returns nullptr on failure (out of memory)
     char* allocate_raw(size_t num_elements) {
         if (num_elements == 0) return nullptr; // Avoid allocating 0 bytes if sizeof(T) is non-zero
-        // This will call the global ::operator new[](size_t)
-        return new char[sizeof(T) * num_elements];
+        return static_cast<char*>(res->allocate(sizeof(T) * num_elements, alignof(T)));
+    }
+
+    // Helper to deallocate raw memory. 'num_elements' is the capacity the
+    // block was allocated with; arenas use it to pop their last allocation.
+    void deallocate_raw(T* ptr_to_t_array, size_t num_elements) {
+        if (!ptr_to_t_array) return;
+        res->deallocate(ptr_to_t_array, sizeof(T) * num_elements, alignof(T));
+    }
+
+    // Gives up the array without freeing it (after its blocks were adopted)
+    void release_storage() {
+        arr = nullptr;
+        current_size = 0;
+        cap = 0;
+    }
+
+    // --- Element Transfer ---
+    // Trivially copyable types (char, integers, plain structs) are moved and
+    // copied as raw bytes in one go; everything else goes through its
+    // constructors one element at a time. Decided at compile time.
+    static constexpr bool is_trivial = __is_trivially_copyable(T);
+
+    // Moves n elements from src to the uninitialized, non-overlapping dst and
+    // destroys the originals.
+    static void relocate(T* dst, T* src, size_t n) {
+        if constexpr (is_trivial) {
+            if (n) memcpy(dst, src, sizeof(T) * n);
+        } else {
+            for (size_t i = 0; i < n; ++i) {
+                new (dst + i) T(static_cast<T&&>(src[i]));
+                src[i].~T();
+            }
+        }
     }
 
-    // Helper to deallocate raw memory
-    void deallocate_raw(T* ptr_to_t_array) {
-        // This will call the global ::operator delete[](void*)
-        delete[] reinterpret_cast<char*>(ptr_to_t_array);
+    // Same as relocate(), for ranges that may overlap (moving inside the array)
+    static void relocate_overlapping(T* dst, T* src, size_t n) {
+        if constexpr (is_trivial) {
+            if (n) memmove(dst, src, sizeof(T) * n);
+        } else if (dst < src) {
+            relocate(dst, src, n); // Front to back never overwrites unread elements
+        } else {
+            for (size_t i = n; i > 0; --i) {
+                new (dst + i - 1) T(static_cast<T&&>(src[i - 1]));
+                src[i - 1].~T();
+            }
+        }
+    }
+
+    // Copy-constructs n elements from src into the uninitialized dst
+    static void copy_construct(T* dst, const T* src, size_t n) {
+        if constexpr (is_trivial) {
+            if (n) memcpy(dst, src, sizeof(T) * n);
+        } else {
+            for (size_t i = 0; i < n; ++i) {
+                new (dst + i) T(src[i]);
+            }
+        }
+    }
+
+    // Makes room for 'extra' more elements, growing geometrically so that
+    // repeated appends stay cheap. Returns false if out of memory.
+    bool grow_for(size_t extra) {
+        size_t needed = current_size + extra;
+        if (needed <= cap) return true;
+        size_t new_cap = (cap == 0) ? 10 : cap * 2;
+        if (new_cap < needed) new_cap = needed;
+        reserve(new_cap);
+        return cap >= needed;
     }
 
 
 public:
     // Default constructor: initialize with a small default capacity (e.g., 0 or 10)
-    vector() : arr(nullptr), current_size(0), cap(0) {
+    vector() : arr(nullptr), current_size(0), cap(0), res(heap_resource()) {
         // Optionally, preallocate a small default capacity:
         // reserve(10); // Or handle allocation on first push_back
     }
 
     // Constructor with initial capacity
-    explicit vector(size_t initial_capacity) : arr(nullptr), current_size(0), cap(0) {
+    explicit vector(size_t initial_capacity) : arr(nullptr), current_size(0), cap(0), res(heap_resource()) {
+        reserve(initial_capacity);
+    }
+
+    // Allocate from a specific resource, e.g. an arena (see arenas.h).
+    // The resource must outlive the vector.
+    explicit vector(mem_resource* resource) : arr(nullptr), current_size(0), cap(0), res(resource) {}
+
+    vector(size_t initial_capacity, mem_resource* resource)
+        : arr(nullptr), current_size(0), cap(0), res(resource) {
         reserve(initial_capacity);
     }
 
     // Destructor: clean up elements and memory
     ~vector() {
         destroy_all_elements();
-        deallocate_raw(arr);
+        deallocate_raw(arr, cap);
         arr = nullptr; // Good practice
     }
 
+    mem_resource* resource() const noexcept {
+        return res;
+    }
+
     // Add an element to the end
     void push_back(const T& value) {
         if (current_size == cap) {
@@ -152,8 +230,9 @@ public:
         return arr[index];
     }
 
-    // Copy constructor
-    vector(const vector& other) : arr(nullptr), current_size(0), cap(0) {
+    // Copy constructor. The copy lives on the kernel heap, not in the source's
+    // resource: copies usually outlive the scratch data they were made from.
+    vector(const vector& other) : arr(nullptr), current_size(0), cap(0), res(heap_resource()) {
         if (other.cap > 0) {
             char* raw_mem = allocate_raw(other.cap);
             if (!raw_mem) { // OOM
@@ -164,45 +243,60 @@ public:
             arr = reinterpret_cast<T*>(raw_mem);
             cap = other.cap;
             current_size = other.current_size;
-            for (size_t i = 0; i < current_size; ++i) {
-                new (arr + i) T(other.arr[i]); // Deep copy elements
-            }
+            copy_construct(arr, other.arr, current_size); // Deep copy elements
         }
     }
 
-    // Copy assignment operator
+    // Copy assignment operator. Keeps this vector's resource.
     vector& operator=(const vector& other) {
         if (this != &other) {
-            // Strong exception guarantee approach (simplified for no exceptions)
-            // Create a temporary copy
-            vector temp(other); // Uses copy constructor (handles OOM there)
-            // Swap contents with the temporary
-            swap(*this, temp);
+            clear();
+            reserve(other.current_size);
+            if (cap < other.current_size) return *this; // OOM
+            copy_construct(arr, other.arr, other.current_size);
+            current_size = other.current_size;
         }
         return *this;
     }
 
-    // Move constructor
+    // Move constructor (the resource moves along with the array). Arrays in a
+    // small_vector's inline buffer cannot leave it; those elements are moved
+    // one by one onto the kernel heap instead.
     vector(vector&& other) noexcept
-        : arr(other.arr), current_size(other.current_size), cap(other.cap) {
-        other.arr = nullptr;
-        other.current_size = 0;
-        other.cap = 0;
+        : arr(other.arr), current_size(other.current_size), cap(other.cap), res(other.res) {
+        if (res->is_portable()) {
+            other.release_storage();
+            return;
+        }
+        arr = nullptr;
+        current_size = 0;
+        cap = 0;
+        res = heap_resource();
+        *this = static_cast<vector&&>(other);
     }
 
-    // Move assignment operator
+    // Move assignment operator. The array can only be adopted if both vectors
+    // allocate from the same resource; otherwise the elements are moved over
+    // one by one into this vector's resource.
     vector& operator=(vector&& other) noexcept {
-        if (this != &other) {
+        if (this == &other) return *this;
+
+        if (res->is_equal(other.res)) {
             destroy_all_elements();
-            deallocate_raw(arr);
+            deallocate_raw(arr, cap);
 
             arr = other.arr;
             current_size = other.current_size;
             cap = other.cap;
 
-            other.arr = nullptr;
-            other.current_size = 0;
-            other.cap = 0;
+            other.release_storage();
+        } else {
+            clear();
+            reserve(other.current_size);
+            if (cap < other.current_size) return *this; // OOM
+            relocate(arr, other.arr, other.current_size);
+            current_size = other.current_size;
+            other.current_size = 0; // relocate() already destroyed them
         }
         return *this;
     }
@@ -216,6 +310,13 @@ public:
     // Reserve capacity for at least n elements
     void reserve(size_t n) {
         if (n > cap) {
+            // Cheapest case: the resource can grow the block where it is, so
+            // no element has to move.
+            if (arr && res->try_expand(arr, sizeof(T) * n, alignof(T))) {
+                cap = n;
+                return;
+            }
+
             char* new_raw_mem = allocate_raw(n);
             if (!new_raw_mem) {
                 // OOM: Failed to reserve. Vector state unchanged regarding capacity.
@@ -224,22 +325,83 @@ public:
             }
             T* new_arr = reinterpret_cast<T*>(new_raw_mem);
 
-            // Move or copy existing elements
-            // If T is not nothrow_move_constructible, we should copy.
-            // For simplicity, we'll copy here, but move would be more efficient.
-            for (size_t i = 0; i < current_size; ++i) {
-                new (new_arr + i) T(static_cast<T&&>(arr[i])); // Try to move
-                (arr + i)->~T(); // Destroy old element after moving
-            }
-            // If we just copied, we'd destroy elements after loop without moving:
-            // destroy_all_elements(); // (if we only copied, not moved)
+            // Move existing elements over (a single memcpy for trivial types)
+            relocate(new_arr, arr, current_size);
 
-            deallocate_raw(arr); // Deallocate old raw memory
+            deallocate_raw(arr, cap); // Deallocate old raw memory
             arr = new_arr;
             cap = n;
         }
     }
 
+    // Gives back unused capacity. Reallocates (and moves every element) unless
+    // the vector is already full; an empty vector frees its array entirely.
+    void shrink_to_fit() {
+        if (cap == current_size) return;
+        if (current_size == 0) {
+            deallocate_raw(arr, cap);
+            arr = nullptr;
+            cap = 0;
+            return;
+        }
+        char* new_raw_mem = allocate_raw(current_size);
+        if (!new_raw_mem) return; // OOM: keep the larger array
+        T* new_arr = reinterpret_cast<T*>(new_raw_mem);
+        relocate(new_arr, arr, current_size);
+        deallocate_raw(arr, cap);
+        arr = new_arr;
+        cap = current_size;
+    }
+
+    // --- Bulk Operations ---
+    // These grow the array once for the whole batch instead of once per
+    // element, and copy trivial types with memcpy/memmove. They return false
+    // (leaving the vector unchanged) when memory runs out. Source ranges must
+    // not point into this vector: growing may move it.
+
+    // Constructs an element in place at the end from the given constructor
+    // arguments. Returns the new element, or nullptr if out of memory.
+    template <typename... Args>
+    T* emplace_back(Args&&... args) {
+        if (!grow_for(1)) return nullptr;
+        T* slot = new (arr + current_size) T(static_cast<Args&&>(args)...);
+        ++current_size;
+        return slot;
+    }
+
+    // Copies n elements from src to the end
+    bool append(const T* src, size_t n) {
+        if (!grow_for(n)) return false;
+        copy_construct(arr + current_size, src, n);
+        current_size += n;
+        return true;
+    }
+
+    // Copies n elements from src in front of position 'index' (index ==
+    // size() appends). Later elements shift up by n.
+    bool insert(size_t index, const T* src, size_t n) {
+        if (index > current_size) return false;
+        if (!grow_for(n)) return false;
+        relocate_overlapping(arr + index + n, arr + index, current_size - index);
+        copy_construct(arr + index, src, n);
+        current_size += n;
+        return true;
+    }
+
+    bool insert(size_t index, const T& value) {
+        return insert(index, &value, 1);
+    }
+
+    // Removes n elements starting at 'index' (clamped to the end). Later
+    // elements shift down to close the gap.
+    void erase(size_t index, size_t n = 1) {
+        if (index >= current_size) return;
+        if (n > current_size - index) n = current_size - index;
+        destroy_elements_range(arr + index, arr + index + n);
+        relocate_overlapping(arr + index, arr + index + n, current_size - index - n);
+        current_size -= n;
+    }
+
     // Resize the vector
     void resize(size_t n) { // Default construct new elements
         resize(n, T());
@@ -268,8 +430,16 @@ public:
         current_size = n;
     }
 
-    // Swap function
+    // Swap function. Vectors whose storage cannot change hands (see
+    // mem_resource::is_portable) swap their elements through a temporary.
     friend void swap(vector& first, vector& second) noexcept {
+        if (!first.res->is_portable() || !second.res->is_portable()) {
+            vector temp(static_cast<vector&&>(first));
+            first = static_cast<vector&&>(second);
+            second = static_cast<vector&&>(temp);
+            return;
+        }
+
         // Manual swap for each member
         T* temp_arr = first.arr;
         first.arr = second.arr;
@@ -282,6 +452,10 @@ public:
         size_t temp_cap = first.cap;
         first.cap = second.cap;
         second.cap = temp_cap;
+
+        mem_resource* temp_res = first.res;
+        first.res = second.res;
+        second.res = temp_res;
     }
 
     // Iterator support
@@ -295,4 +469,235 @@ public:
     const T* data() const noexcept { return arr; }
 };
 
+// --- Small Vector ---
+// A vector<T> that keeps its first N elements in an inline buffer, so short
+// sequences (a command line, a list of arguments) never touch the allocator.
+// Growing past N spills to the kernel heap transparently; once spilled, the
+// vector stays on the heap (clear() keeps the capacity). A small_vector is a vector<T>, so it can be passed to any
+// function taking vector<T>&.
+//
+// The inline buffer is the vector's mem_resource. It is a base class listed
+// before vector<T>, so it is constructed before the vector allocates from it
+// and destroyed after the vector has given the buffer back.
+
+template <typename T, size_t N>
+class small_vector_storage : public mem_resource {
+private:
+    alignas(T) unsigned char buffer[sizeof(T) * N];
+    bool in_use;
+
+public:
+    small_vector_storage() : in_use(false) {}
+
+    small_vector_storage(const small_vector_storage&) = delete;
+    small_vector_storage& operator=(const small_vector_storage&) = delete;
+
+    void* allocate(size_t bytes, size_t align) override {
+        if (!in_use && bytes <= sizeof(buffer) && align <= alignof(T)) {
+            in_use = true;
+            return buffer;
+        }
+        return heap_resource()->allocate(bytes, align);
+    }
+
+    void deallocate(void* ptr, size_t bytes, size_t align) override {
+        if (ptr == buffer) {
+            in_use = false;
+            return;
+        }
+        heap_resource()->deallocate(ptr, bytes, align);
+    }
+
+    bool try_expand(void* ptr, size_t new_bytes, size_t align) override {
+        if (ptr == buffer) {
+            return new_bytes <= sizeof(buffer);
+        }
+        return heap_resource()->try_expand(ptr, new_bytes, align);
+    }
+
+    bool is_portable() const override { return false; }
+
+    bool owns(const void* ptr) const { return ptr == buffer; }
+};
+
+template <typename T, size_t N>
+class small_vector : private small_vector_storage<T, N>, public vector<T> {
+private:
+    using storage = small_vector_storage<T, N>;
+
+public:
+    small_vector() : vector<T>(N, static_cast<storage*>(this)) {}
+
+    small_vector(const small_vector& other) : vector<T>(N, static_cast<storage*>(this)) {
+        vector<T>::operator=(other);
+    }
+
+    small_vector(const vector<T>& other) : vector<T>(N, static_cast<storage*>(this)) {
+        vector<T>::operator=(other);
+    }
+
+    // Elements are moved over (memcpy for trivial types): the other buffer
+    // cannot be adopted.
+    small_vector(small_vector&& other) noexcept : vector<T>(N, static_cast<storage*>(this)) {
+        vector<T>::operator=(static_cast<vector<T>&&>(other));
+    }
+
+    small_vector& operator=(const small_vector& other) {
+        vector<T>::operator=(other);
+        return *this;
+    }
+
+    small_vector& operator=(small_vector&& other) noexcept {
+        vector<T>::operator=(static_cast<vector<T>&&>(other));
+        return *this;
+    }
+
+    // Number of elements that fit without a heap allocation
+    static constexpr size_t inline_capacity() { return N; }
+
+    // Shrinks a spilled vector (back into the inline buffer if it fits now).
+    // Calling vector<T>::shrink_to_fit() on an inline vector would move it
+    // out to the heap, so that case is left alone here.
+    void shrink_to_fit() {
+        if (is_inline()) return;
+        vector<T>::shrink_to_fit();
+    }
+
+    // True while the elements live in the inline buffer
+    bool is_inline() const {
+        return static_cast<const storage*>(this)->owns(this->data());
+    }
+};
+
+// --- Static Vector ---
+// A vector with room for exactly N elements stored inside the object: it never
+// allocates, so it is safe in interrupt handlers and before the heap exists.
+// push_back() and emplace_back() fail (return false / nullptr) when it is
+// full. The constructor is constexpr and, for trivially destructible T, the
+// destructor is trivial, so a global static_vector needs no runtime setup
+// (boot.asm does not run global constructors).
+//
+// Copying is not allowed, so the N elements are never duplicated by accident;
+// copy explicitly with assign() if that is really meant.
+
+// The elements sit in a union with a dummy member, so constructing the
+// container does not construct (or zero) the elements.
+template <typename T, size_t N, bool = __has_trivial_destructor(T)>
+struct static_vector_storage {
+    union {
+        char unused;
+        T items[N];
+    };
+    size_t count;
+
+    constexpr static_vector_storage() : unused(0), count(0) {}
+};
+
+// Elements with a destructor: destroy the live ones.
+template <typename T, size_t N>
+struct static_vector_storage<T, N, false> {
+    union {
+        char unused;
+        T items[N];
+    };
+    size_t count;
+
+    constexpr static_vector_storage() : unused(0), count(0) {}
+    ~static_vector_storage() {
+        for (size_t i = 0; i < count; ++i) {
+            items[i].~T();
+        }
+    }
+};
+
+template <typename T, size_t N>
+class static_vector : private static_vector_storage<T, N> {
+private:
+    using storage = static_vector_storage<T, N>;
+    using storage::items;
+    using storage::count;
+
+public:
+    constexpr static_vector() {}
+
+    static_vector(const static_vector&) = delete;
+    static_vector& operator=(const static_vector&) = delete;
+
+    size_t size() const { return count; }
+    static constexpr size_t capacity() { return N; }
+    bool empty() const { return count == 0; }
+    bool full() const { return count == N; }
+
+    T& operator[](size_t index) { return items[index]; }
+    const T& operator[](size_t index) const { return items[index]; }
+
+    T* data() { return items; }
+    const T* data() const { return items; }
+    T* begin() { return items; }
+    const T* begin() const { return items; }
+    T* end() { return items + count; }
+    const T* end() const { return items + count; }
+
+    // Returns false when full
+    bool push_back(const T& value) {
+        if (count == N) return false;
+        new (items + count) T(value);
+        count++;
+        return true;
+    }
+
+    // Constructs the element in place. Returns it, or nullptr when full.
+    template <typename... Args>
+    T* emplace_back(Args&&... args) {
+        if (count == N) return nullptr;
+        T* slot = new (items + count) T(static_cast<Args&&>(args)...);
+        count++;
+        return slot;
+    }
+
+    void pop_back() {
+        if (count > 0) {
+            count--;
+            items[count].~T();
+        }
+    }
+
+    // Removes the element at 'index', keeping the order of the rest (O(n)).
+    void erase(size_t index) {
+        if (index >= count) return;
+        for (size_t i = index; i + 1 < count; ++i) {
+            items[i] = static_cast<T&&>(items[i + 1]);
+        }
+        pop_back();
+    }
+
+    // Removes the element at 'index' by moving the last one into its place
+    // (O(1), changes the order).
+    void erase_unordered(size_t index) {
+        if (index >= count) return;
+        if (index + 1 < count) {
+            items[index] = static_cast<T&&>(items[count - 1]);
+        }
+        pop_back();
+    }
+
+    void clear() {
+        while (count > 0) {
+            pop_back();
+        }
+    }
+
+    // Replaces the contents with n elements from src. Returns false (and
+    // copies nothing) if they do not fit.
+    bool assign(const T* src, size_t n) {
+        if (n > N) return false;
+        clear();
+        for (size_t i = 0; i < n; ++i) {
+            new (items + i) T(src[i]);
+        }
+        count = n;
+        return true;
+    }
+};
+
 #endif // VECTORS_H
\ No newline at end of file
@@ -0,0 +1,186 @@
+#include "include/interrupts.h"
+#include "include/io.h"      // For outb/inb (PIC ports)
+#include "include/inits.h"   // For INIT_CODE
+#include "include/formats.h" // For kprintf_color() in the exception report
+#include "include/screens.h" // For screen_flush() before halting
+#include "include/serials.h" // For serial_flush() before halting
+
+// --- IDT ---
+
+struct idt_entry {
+    uint16_t base_lo;
+    uint16_t sel;
+    uint8_t always0;
+    uint8_t flags;
+    uint16_t base_hi;
+} __attribute__((packed));
+
+struct idt_ptr {
+    uint16_t limit;
+    uint32_t base;
+} __attribute__((packed));
+
+#define IDT_ENTRIES       256
+#define KERNEL_CODE_SEL   0x08 // GDT_CODE_SELECTOR in boot.asm
+#define IDT_INTERRUPT_GATE 0x8E // Present, ring 0, 32-bit interrupt gate (clears IF)
+
+static idt_entry idt[IDT_ENTRIES];
+
+extern "C" {
+    idt_ptr idtp; // Read by load_idt
+
+    // From isr_assembly.asm
+    void load_idt();
+    extern const uint32_t exception_stub_table[EXCEPTION_COUNT];
+    extern const uint32_t irq_stub_table[IRQ_COUNT];
+}
+
+static void idt_set_gate(uint8_t num, uint32_t base, uint16_t sel, uint8_t flags) {
+    idt[num].base_lo = base & 0xFFFF;
+    idt[num].base_hi = (base >> 16) & 0xFFFF;
+    idt[num].sel = sel;
+    idt[num].always0 = 0;
+    idt[num].flags = flags;
+}
+
+// --- 8259 PIC ---
+
+#define PIC1_COMMAND 0x20
+#define PIC1_DATA    0x21
+#define PIC2_COMMAND 0xA0
+#define PIC2_DATA    0xA1
+
+#define PIC_EOI       0x20
+#define PIC_READ_ISR  0x0B // OCW3: the next command-port read returns the in-service register
+#define ICW1_INIT     0x11 // Initialise, ICW4 follows
+#define ICW4_8086     0x01
+
+static irq_handler irq_handlers[IRQ_COUNT];
+static uint16_t irq_masked = 0xFFFF; // Bit n set: line n is masked (cached, the PICs are slow to read)
+
+// Port 0x80 is unused: writing it gives the old PICs time between commands.
+static inline void io_wait() {
+    outb(0x80, 0);
+}
+
+static void pic_write_masks() {
+    outb(PIC1_DATA, (uint8_t)irq_masked);
+    outb(PIC2_DATA, (uint8_t)(irq_masked >> 8));
+}
+
+INIT_CODE static void pic_remap() {
+    outb(PIC1_COMMAND, ICW1_INIT); io_wait();
+    outb(PIC2_COMMAND, ICW1_INIT); io_wait();
+    outb(PIC1_DATA, IRQ_BASE); io_wait();     // ICW2: vector offsets
+    outb(PIC2_DATA, IRQ_BASE + 8); io_wait();
+    outb(PIC1_DATA, 1 << IRQ_CASCADE); io_wait(); // ICW3: slave on IRQ 2
+    outb(PIC2_DATA, IRQ_CASCADE); io_wait();      //       slave's cascade identity
+    outb(PIC1_DATA, ICW4_8086); io_wait();
+    outb(PIC2_DATA, ICW4_8086); io_wait();
+
+    irq_masked = (uint16_t)~(1u << IRQ_CASCADE);
+    pic_write_masks();
+}
+
+// --- Interrupt Function Definitions ---
+
+INIT_CODE void interrupts_init() {
+    idtp.limit = sizeof(idt) - 1;
+    idtp.base = (uint32_t)(uintptr_t)&idt;
+
+    // Vectors without a gate are not present: hitting one faults instead of
+    // jumping to address 0.
+    for (uint32_t i = 0; i < EXCEPTION_COUNT; ++i) {
+        idt_set_gate(i, exception_stub_table[i], KERNEL_CODE_SEL, IDT_INTERRUPT_GATE);
+    }
+    for (uint32_t i = 0; i < IRQ_COUNT; ++i) {
+        idt_set_gate(IRQ_BASE + i, irq_stub_table[i], KERNEL_CODE_SEL, IDT_INTERRUPT_GATE);
+    }
+
+    pic_remap();
+    load_idt();
+}
+
+void irq_install_handler(uint8_t irq, irq_handler handler) {
+    if (irq >= IRQ_COUNT) {
+        return;
+    }
+    irq_handlers[irq] = handler;
+    irq_unmask(irq);
+}
+
+void irq_mask(uint8_t irq) {
+    uint32_t flags = interrupts_save_disable();
+    irq_masked |= (uint16_t)(1u << irq);
+    pic_write_masks();
+    interrupts_restore(flags);
+}
+
+void irq_unmask(uint8_t irq) {
+    uint32_t flags = interrupts_save_disable();
+    irq_masked &= (uint16_t)~(1u << irq);
+    pic_write_masks();
+    interrupts_restore(flags);
+}
+
+// Called by the IRQ stubs with the line number.
+extern "C" void irq_dispatch(uint32_t irq) {
+    // IRQ 7 and 15 are also what a PIC reports when a line dropped before it
+    // could be serviced. Such a spurious IRQ is not in service and must not
+    // be acknowledged (a spurious 15 still came through the master, though).
+    if (irq == 7 || irq == 15) {
+        uint16_t command = irq == 7 ? PIC1_COMMAND : PIC2_COMMAND;
+        outb(command, PIC_READ_ISR);
+        if (!(inb(command) & 0x80)) {
+            if (irq == 15) {
+                outb(PIC1_COMMAND, PIC_EOI);
+            }
+            return;
+        }
+    }
+
+    if (irq_handlers[irq]) {
+        irq_handlers[irq]();
+    }
+
+    if (irq >= 8) {
+        outb(PIC2_COMMAND, PIC_EOI);
+    }
+    outb(PIC1_COMMAND, PIC_EOI);
+}
+
+// --- CPU Exceptions ---
+
+static const char* const exception_names[EXCEPTION_COUNT] = {
+    "Divide error", "Debug", "NMI", "Breakpoint",
+    "Overflow", "BOUND range exceeded", "Invalid opcode", "Device not available",
+    "Double fault", "Coprocessor segment overrun", "Invalid TSS", "Segment not present",
+    "Stack-segment fault", "General protection fault", "Page fault", "Reserved",
+    "x87 floating-point error", "Alignment check", "Machine check", "SIMD floating-point error",
+    "Virtualization exception", "Control protection exception", "Reserved", "Reserved",
+    "Reserved", "Reserved", "Reserved", "Reserved",
+    "Hypervisor injection exception", "VMM communication exception", "Security exception", "Reserved",
+};
+
+// Called by the exception stubs. None of the exceptions are recoverable in
+// this kernel yet, so this reports the fault on screen and serial and halts.
+extern "C" void exception_dispatch(exception_frame* frame) {
+    uint32_t cr2;
+    asm volatile("mov %%cr2, %0" : "=r"(cr2));
+
+    kprintf_color(VGA_COLOR_LIGHT_RED, "\nKERNEL PANIC: %s (exception %u, error code %#x)\n",
+                  exception_names[frame->vector & (EXCEPTION_COUNT - 1)], frame->vector, frame->error);
+    kprintf_color(VGA_COLOR_LIGHT_RED, "EIP=%08x CS=%04x EFLAGS=%08x", frame->eip, frame->cs, frame->eflags);
+    if (frame->vector == 14) {
+        kprintf_color(VGA_COLOR_LIGHT_RED, " CR2=%08x", cr2); // Faulting address
+    }
+    kprintf_color(VGA_COLOR_LIGHT_RED, "\nEAX=%08x EBX=%08x ECX=%08x EDX=%08x\nESI=%08x EDI=%08x EBP=%08x\n",
+                  frame->eax, frame->ebx, frame->ecx, frame->edx, frame->esi, frame->edi, frame->ebp);
+    kprintf_color(VGA_COLOR_LIGHT_RED, "System halted.\n");
+
+    screen_flush();
+    serial_flush();
+    while (true) {
+        asm volatile("cli; hlt");
+    }
+}
@@ -1,6 +1,10 @@
 #include "include/io.h"
-#include "include/screens.h" // For scroll_screen() and screen globals like vga_buffer, cursor_x/y
+#include "include/screens.h" // For scroll_screen(), screen_put()/screen_flush() and cursor_x/y
 #include "include/consts.h"  // For VGA_WIDTH, VGA_HEIGHT, KEY_LIMIT, key scancodes, etc.
+#include "include/pages.h"   // For pages_zero_idle() while waiting for keys
+#include "include/keyboards.h" // For the IRQ-driven key buffer
+#include "include/formats.h" // For format_uint()
+#include "include/logs.h"    // For klog_drain() while waiting for keys
 
 // --- Extern Global Variable Definitions (these are actually defined elsewhere, but io.cpp uses them via headers) ---
 // No need to redefine them here; they are accessed via their declarations in included headers.
@@ -14,23 +18,42 @@
 // const uint8_t KEY_LIMIT;       // Defined in consts.cpp
 
 
+// --- Output Sinks ---
+
+static static_vector<output_sink, CONSOLE_MAX_SINKS> output_sinks;
+
+bool console_add_sink(output_sink sink) {
+    return output_sinks.push_back(sink);
+}
+
+static void mirror_to_sinks(const char* text, size_t n) {
+    for (size_t i = 0; i < output_sinks.size(); ++i) {
+        output_sinks[i](text, n);
+    }
+}
+
 // --- Character and String Printing Function Definitions ---
 
-void print_char(char c, bool inplace, int color) { // Removed default args as they are in header
+// print_char() without the sinks, for callers that already mirrored the text.
+static void put_char(char c, bool inplace, int color) {
+    if (!inplace) {
+        screen_view_live(); // New output: leave the scrollback
+    }
+
     if (c == '\n') {
         cursor_x = 0;
         cursor_y++;
     } else if (c == '\t') {
         int spaces_to_add = 4 - (cursor_x % 4);
         for (int i = 0; i < spaces_to_add; ++i) {
-            print_char(' ', false, color);
+            put_char(' ', false, color);
         }
         return;
     } else {
         // This check might be slightly redundant if scroll_screen is always called correctly,
         // but it's a safe guard.
         if (cursor_y >= VGA_HEIGHT) {
-             scroll_screen(vga_buffer); // Assuming global vga_buffer is intended if param is used
+             scroll_screen();
              cursor_y = VGA_HEIGHT - 1;
         }
         
@@ -40,17 +63,14 @@ void print_char(char c, bool inplace, int color) { // Removed default args as th
             cursor_y++;
             // Check cursor_y again if wrapping cursor_x caused it to go out of bounds
             if (cursor_y >= VGA_HEIGHT) {
-                 scroll_screen(vga_buffer);
+                 scroll_screen();
                  cursor_y = VGA_HEIGHT - 1;
             }
         }
 
 
-        uint16_t position = cursor_y * VGA_WIDTH + cursor_x;
-        // Final boundary check before writing to VGA buffer
-        if (position < (unsigned int)(VGA_WIDTH * VGA_HEIGHT)) { // Cast to unsigned for comparison if VGA_WIDTH/HEIGHT are large
-             vga_buffer[position] = (uint16_t)((color << 8) | c);
-        }
+        // Into the shadow screen; screen_put() ignores positions off screen
+        screen_put(cursor_x, cursor_y, (uint16_t)((color << 8) | c));
 
         if (!inplace) {
             cursor_x++;
@@ -62,75 +82,96 @@ void print_char(char c, bool inplace, int color) { // Removed default args as th
     }
 
     if (cursor_y >= VGA_HEIGHT) {
-        scroll_screen(vga_buffer); // Use global vga_buffer, or pass it if design prefers
+        scroll_screen();
         cursor_y = VGA_HEIGHT - 1;
     }
 }
 
-void print_string(const char* str, int color) { // Default arg in header
-    for (int i = 0; str[i] != '\0'; ++i) {
-        print_char(str[i], false, color);
+void print_char(char c, bool inplace, int color) { // Removed default args as they are in header
+    if (!inplace) {
+        mirror_to_sinks(&c, 1); // In-place writes only redraw the screen
     }
+    put_char(c, inplace, color);
 }
 
-void print_vector(const vector<char>& v, int color) { // Default arg in header
-    for (size_t i = 0; i < v.size(); ++i) {
-        print_char(v[i], false, color);
+void console_write(const char* text, size_t n, int color) { // Default arg in header
+    screen_view_live(); // New output: leave the scrollback
+    mirror_to_sinks(text, n);
+
+    size_t i = 0;
+    while (i < n) {
+        char c = text[i];
+        if (c == '\n' || c == '\t') {
+            put_char(c, false, color);
+            i++;
+            continue;
+        }
+
+        if (cursor_x >= VGA_WIDTH) {
+            cursor_x = 0;
+            cursor_y++;
+        }
+        if (cursor_y >= VGA_HEIGHT) {
+            scroll_screen();
+            cursor_y = VGA_HEIGHT - 1;
+        }
+
+        // The run of ordinary characters that still fits on this line
+        size_t run = 1;
+        size_t room = VGA_WIDTH - cursor_x;
+        while (run < room && i + run < n && text[i + run] != '\n' && text[i + run] != '\t') {
+            run++;
+        }
+        screen_write(cursor_x, cursor_y, text + i, run, color);
+        i += run;
+
+        cursor_x += run;
+        if (cursor_x >= VGA_WIDTH) {
+            cursor_x = 0;
+            cursor_y++;
+            if (cursor_y >= VGA_HEIGHT) {
+                scroll_screen();
+                cursor_y = VGA_HEIGHT - 1;
+            }
+        }
     }
 }
 
+void print_string(const char* str, int color) { // Default arg in header
+    console_write(str, str_length(str), color);
+}
+
+void print_string(string_view str, int color) { // Default arg in header
+    console_write(str.data(), str.size(), color);
+}
+
+void print_vector(const vector<char>& v, int color) { // Default arg in header
+    console_write(v.data(), v.size(), color);
+}
+
 void print_uint_base(unsigned long long n, int base, int color, bool print_prefix) {
-    char buffer[65];
-    int i = 0;
-    const char* digits_map = "0123456789abcdef"; // Renamed 'digits' to avoid conflict if there's a global var
+    char buffer[66];
+    char* end = buffer + sizeof(buffer);
 
     if (base < 2 || base > 16) {
         print_string("[Invalid Base]", VGA_COLOR_LIGHT_RED);
         return;
     }
 
-    if (n == 0) {
-        buffer[i++] = '0';
-    } else {
-        while (n > 0) {
-            buffer[i++] = digits_map[n % base];
-            n /= base;
-        }
-    }
-
+    char* p = format_uint(end, n, base); // No 64-bit division (see formats.h)
     if (print_prefix) {
-        if (base == 16) { buffer[i++] = 'x'; buffer[i++] = '0'; }
-        else if (base == 2) { buffer[i++] = 'b'; buffer[i++] = '0'; }
-    }
-
-    buffer[i] = '\0';
-
-    int start = 0, end = i - 1;
-    while (start < end) {
-        char temp = buffer[start];
-        buffer[start] = buffer[end];
-        buffer[end] = temp;
-        start++;
-        end--;
+        if (base == 16) { *--p = 'x'; *--p = '0'; }
+        else if (base == 2) { *--p = 'b'; *--p = '0'; }
     }
-    print_string(buffer, color);
+    console_write(p, end - p, color);
 }
 
 void print_int(long long n, int color) { // Default arg in header
-    if (n == 0) {
-        print_char('0', false, color);
-        return;
-    }
     if (n < 0) {
         print_char('-', false, color);
-        // Special case for LLONG_MIN
-        if (n == (-9223372036854775807LL - 1LL)) {
-            print_string("9223372036854775808", color); // Print as string
-            return;
-        }
-        n = -n; // Make n positive
     }
-    print_uint_base((unsigned long long)n, 10, color, false);
+    // Negate as unsigned, which is also right for LLONG_MIN
+    print_uint_base(n < 0 ? 0 - (unsigned long long)n : (unsigned long long)n, 10, color, false);
 }
 
 void print_hex(uint64_t n, int color) { // Default arg in header
@@ -152,20 +193,29 @@ char scancode_to_ascii(uint8_t scancode, bool shift_pressed) {
     return shift_pressed ? scancode_ascii_shifted[scancode] : scancode_ascii_normal[scancode];
 }
 
-uint8_t scankey() {
-    uint8_t scancode; // No need to initialize to 0, will be overwritten
+uint16_t scankey() {
     while (true) {
-        if (inb(0x64) & 0x1) { // Check status port 0x64, bit 0 (output buffer full)
-            scancode = inb(0x60); // Read data from port 0x60
-            // PS/2 typically sends scancodes > 0.
-            // A 0 might indicate an error or be part of a multi-byte sequence (not handled here).
-            // For simplicity, we assume valid single-byte scancodes are non-zero.
-            if (scancode != 0) { // Basic check, could be more robust
-                return scancode;
-            }
+        klog_drain();   // Log messages that are still only in the ring
+        screen_flush(); // Show everything printed so far before waiting
+
+        uint16_t key = keyboard_get_key();
+        if (key != KEY_NONE) {
+            return key;
+        }
+        // Nothing typed yet: use the wait to clear pages for later zeroed allocations.
+        if (pages_zero_idle()) {
+            continue;
         }
-        // Consider a short delay or 'pause' instruction if this loop consumes too much CPU
-        // asm volatile("pause"); // Especially if interrupts are disabled for long periods.
+        // Nothing left to do: sleep until the next interrupt (a key, most
+        // likely). The check runs with interrupts off, and 'sti' only takes
+        // effect after the following 'hlt' has started, so a key arriving
+        // in between still wakes it.
+        asm volatile("cli");
+        if (keyboard_has_data()) {
+            asm volatile("sti");
+            continue;
+        }
+        asm volatile("sti; hlt");
     }
 }
 
@@ -181,34 +231,27 @@ void input(vector<char>& v, int color) { // Default arg in header
 
 
     while (true) {
-        uint16_t temp_cursor_x = cursor_x; // Save current cursor for drawing temp '_'
-        uint16_t temp_cursor_y = cursor_y;
-        
-        // Draw temporary cursor if current position is valid
-        if (temp_cursor_y < VGA_HEIGHT && temp_cursor_x < VGA_WIDTH) {
-            print_char('_', true, VGA_COLOR_DARK_GREY);
-        }
-
-        uint8_t scancode = scankey();
+        // The blinking hardware cursor marks the input position; scankey()'s
+        // flush moves it to cursor_x/cursor_y.
+        uint16_t key = scankey();
 
-        // Erase temporary cursor (unless backspace, which handles its own screen update)
-        if (scancode != BACKSPACE) {
-            if (temp_cursor_y < VGA_HEIGHT && temp_cursor_x < VGA_WIDTH) {
-                 uint16_t pos = temp_cursor_y * VGA_WIDTH + temp_cursor_x;
-                 vga_buffer[pos] = (uint16_t)((VGA_DEFAULT_COLOR << 8) | ' '); // Erase with default color space
-            }
-        }
-
-        switch (scancode) {
+        switch (key) {
             case ENTER:
+            case KEYPAD_ENTER:
+                screen_view_live();
                 return; // Input finished
 
+            // Page through the scrollback, keeping one line of overlap
+            case PAGE_UP:   screen_view_scroll(SCREEN_ROWS - 1); break;
+            case PAGE_DOWN: screen_view_scroll(-(SCREEN_ROWS - 1)); break;
+
             case SHIFT_PRESSED_LEFT:  left_shift_pressed = true; break;
             case SHIFT_RELEASED_LEFT: left_shift_pressed = false; break;
             case SHIFT_PRESSED_RIGHT: right_shift_pressed = true; break;
             case SHIFT_RELEASED_RIGHT:right_shift_pressed = false; break;
 
             case BACKSPACE:
+                screen_view_live();
                 if (!v.empty()) {
                     v.pop_back();
 
@@ -223,29 +266,20 @@ void input(vector<char>& v, int color) { // Default arg in header
                         cursor_x--;
                     } else {
                         // At the very start of the input line, do nothing with cursor
-                        // but ensure the temp '_' is erased if it was there
-                        if (temp_cursor_y < VGA_HEIGHT && temp_cursor_x < VGA_WIDTH) {
-                             uint16_t pos = temp_cursor_y * VGA_WIDTH + temp_cursor_x;
-                             vga_buffer[pos] = (uint16_t)((VGA_DEFAULT_COLOR << 8) | ' ');
-                        }
                         break; 
                     }
                     // Erase char on screen by printing a space at the new cursor position
                     print_char(' ', true, VGA_DEFAULT_COLOR); // Use default color for erasing
-                } else {
-                    // Input buffer is empty, just erase the temp cursor if it was drawn
-                     if (temp_cursor_y < VGA_HEIGHT && temp_cursor_x < VGA_WIDTH) {
-                        uint16_t pos = temp_cursor_y * VGA_WIDTH + temp_cursor_x;
-                        vga_buffer[pos] = (uint16_t)((VGA_DEFAULT_COLOR << 8) | ' ');
-                    }
+                    mirror_to_sinks("\b \b", 3); // The same on a terminal
                 }
                 break;
 
             default:
                 // Process only key presses (make codes), ignore key releases (break codes, usually scancode | 0x80)
-                if (!(scancode & 0x80)) {
+                // and extended keys that are not handled above (arrows etc.)
+                if (!(key & (0x80 | KEY_EXTENDED))) {
                     bool shift_pressed = left_shift_pressed || right_shift_pressed;
-                    char c = scancode_to_ascii(scancode, shift_pressed);
+                    char c = scancode_to_ascii((uint8_t)key, shift_pressed);
                     if (c != 0) { // If it's a printable character (not null)
                         // Optional: Add a MAX_INPUT_LENGTH check here
                         // if (v.size() < MAX_INPUT_LENGTH) {
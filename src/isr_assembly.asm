@@ -0,0 +1,128 @@
+; isr_assembly.asm - Interrupt entry stubs and the IDT loader
+
+section .note.GNU-stack noalloc noexec nowrite progbits
+; Add this section to prevent linker warnings about executable stack
+
+section .text
+global load_idt              ; Make IDT loader visible to C code
+global irq_stub_table        ; Stub addresses, for interrupts_init()
+global exception_stub_table
+extern irq_dispatch          ; C++ dispatchers in interrupts.cpp
+extern exception_dispatch
+extern idtp                  ; Reference to IDT pointer structure
+
+; --- CPU Exceptions (vectors 0-31) ---
+; Some exceptions make the CPU push an error code and some do not. The stubs
+; for the others push a 0 in its place, so that every exception reaches
+; exception_dispatch with the same frame (see exception_frame).
+%macro EXCEPTION_STUB 1
+exception_stub_%1:
+    push dword 0             ; No error code
+    push dword %1
+    jmp exception_common
+%endmacro
+
+%macro EXCEPTION_STUB_ERR 1
+exception_stub_%1:
+    push dword %1            ; The CPU already pushed the error code
+    jmp exception_common
+%endmacro
+
+EXCEPTION_STUB 0
+EXCEPTION_STUB 1
+EXCEPTION_STUB 2
+EXCEPTION_STUB 3
+EXCEPTION_STUB 4
+EXCEPTION_STUB 5
+EXCEPTION_STUB 6
+EXCEPTION_STUB 7
+EXCEPTION_STUB_ERR 8
+EXCEPTION_STUB 9
+EXCEPTION_STUB_ERR 10
+EXCEPTION_STUB_ERR 11
+EXCEPTION_STUB_ERR 12
+EXCEPTION_STUB_ERR 13
+EXCEPTION_STUB_ERR 14
+EXCEPTION_STUB 15
+EXCEPTION_STUB 16
+EXCEPTION_STUB_ERR 17
+EXCEPTION_STUB 18
+EXCEPTION_STUB 19
+EXCEPTION_STUB 20
+EXCEPTION_STUB_ERR 21
+EXCEPTION_STUB 22
+EXCEPTION_STUB 23
+EXCEPTION_STUB 24
+EXCEPTION_STUB 25
+EXCEPTION_STUB 26
+EXCEPTION_STUB 27
+EXCEPTION_STUB 28
+EXCEPTION_STUB_ERR 29
+EXCEPTION_STUB_ERR 30
+EXCEPTION_STUB 31
+
+exception_common:
+    pusha                    ; Push all registers
+    cld
+    push esp                 ; Pointer to the frame built above
+    call exception_dispatch
+    add esp, 4               ; Drop the argument
+    popa                     ; Pop all registers
+    add esp, 8               ; Drop the vector and the error code
+    iret
+
+; --- IRQs (vectors IRQ_BASE..IRQ_BASE + 15) ---
+; One stub per IRQ line: push the line number and take the common path.
+%macro IRQ_STUB 1
+irq_stub_%1:
+    push dword %1
+    jmp irq_common
+%endmacro
+
+IRQ_STUB 0
+IRQ_STUB 1
+IRQ_STUB 2
+IRQ_STUB 3
+IRQ_STUB 4
+IRQ_STUB 5
+IRQ_STUB 6
+IRQ_STUB 7
+IRQ_STUB 8
+IRQ_STUB 9
+IRQ_STUB 10
+IRQ_STUB 11
+IRQ_STUB 12
+IRQ_STUB 13
+IRQ_STUB 14
+IRQ_STUB 15
+
+irq_common:
+    pusha                    ; Push all registers
+    cld                      ; Compiled code expects the direction flag clear
+    push dword [esp + 32]    ; IRQ number (above the 8 registers from pusha)
+    call irq_dispatch
+    add esp, 4               ; Drop the argument
+    popa                     ; Pop all registers
+    add esp, 4               ; Drop the IRQ number
+    iret                     ; Return from interrupt
+
+; Load IDT function
+load_idt:
+    lidt [idtp]              ; Load the IDT pointer
+    ret                      ; Return to caller
+
+section .rodata
+align 4
+exception_stub_table:
+%assign i 0
+%rep 32
+    dd exception_stub_%+i
+%assign i i + 1
+%endrep
+
+irq_stub_table:
+%assign i 0
+%rep 16
+    dd irq_stub_%+i
+%assign i i + 1
+%endrep
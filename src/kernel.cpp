@@ -3,64 +3,25 @@
 // OS-specific includes - These bring in DECLARATIONS
 #include "include/consts.h"    // For VGA Colors, Keyboard scancode defines, KEY_LIMIT etc.
 #include "include/vectors.h"   // For vector<char>
+#include "include/strings.h"   // For string_view (command parsing)
+#include "include/maps.h"      // For the command table
 #include "include/memorys.h"   // For multiboot_info and memory functions/allocators
+#include "include/pages.h"     // For pages_init() and the physical page allocator
+#include "include/arenas.h"    // For the per-command scratch arena
+#include "include/inits.h"     // For free_init_memory()
+#include "include/stacks.h"    // For stack high-water marks
 #include "include/screens.h"   // For cls() and screen-related externs (vga_buffer, cursor_x/y)
 #include "include/io.h"        // For print_*, input(), inb, outw, etc.
+#include "include/formats.h"   // For kprintf()
 #include "include/acpi.h"      // For acpi_init(), acpi_power_off(), and FADT extern
+#include "include/interrupts.h" // For interrupts_init()
+#include "include/serials.h"   // For the serial console
+#include "include/keyboards.h" // For keyboard_init()
+#include "include/logs.h"      // For the kernel log and 'dmesg'
 
-// --- Helper functions for string/vector operations ---
-static bool streq_vec(const vector<char>& vec, const char* c_str) {
-    size_t c_str_len = 0;
-    while (c_str[c_str_len] != '\0') {
-        c_str_len++;
-    }
-    if (vec.size() != c_str_len) {
-        return false;
-    }
-    for (size_t i = 0; i < vec.size(); ++i) {
-        if (vec[i] != c_str[i]) {
-            return false;
-        }
-    }
-    return true;
-}
-
-static bool strstarts_vec(const vector<char>& vec, const char* prefix) {
-    size_t prefix_len = 0;
-    while (prefix[prefix_len] != '\0') {
-        prefix_len++;
-    }
-    if (vec.size() < prefix_len) {
-        return false;
-    }
-    for (size_t i = 0; i < prefix_len; ++i) {
-        if (vec[i] != prefix[i]) {
-            return false;
-        }
-    }
-    return true;
-}
-
-static void print_vector_char_range(const vector<char>& vec, size_t start_index, uint8_t color) {
-    if (start_index >= vec.size()) {
-        return;
-    }
-    const int MAX_ARG_LEN = 256;
-    char buffer[MAX_ARG_LEN];
-    size_t len_to_print = vec.size() - start_index;
-
-    if (len_to_print >= MAX_ARG_LEN) {
-        len_to_print = MAX_ARG_LEN - 1;
-    }
-    for (size_t i = 0; i < len_to_print; ++i) {
-        buffer[i] = vec[start_index + i];
-    }
-    buffer[len_to_print] = '\0';
-    print_string(buffer, color);
-}
-
+// --- Helper functions for command parsing ---
 // Basic string to integer conversion.
-static long long simple_str_to_long(const vector<char>& vec, size_t& index) {
+static long long simple_str_to_long(string_view vec, size_t& index) {
     long long res = 0;
     bool is_negative = false;
     bool found_digit_or_sign = false;
@@ -101,39 +62,317 @@ static long long simple_str_to_long(const vector<char>& vec, size_t& index) {
 }
 
 
+// --- meminfo command ---
+
+static void print_meminfo(const arena& command_arena) {
+    heap_stats hs;
+    heap_get_stats(&hs);
+
+    print_string("Heap: ", VGA_COLOR_WHITE);
+    kprintf("%zu KB in use, peak %zu KB, %u allocs, %u frees, %u failed\n",
+            hs.bytes_in_use / 1024, hs.peak_bytes / 1024, hs.alloc_count, hs.free_count, hs.failed_count);
+
+    // Lifetime share of handed-out bytes that callers did not ask for (size-class rounding).
+    uint32_t internal_pct = 0;
+    if (hs.allocated_bytes > 0) {
+        // divmod_u64() divides by 32 bits only: scale both totals down until the
+        // divisor fits, which does not change the ratio noticeably.
+        uint64_t allocated = hs.allocated_bytes;
+        uint64_t wasted = hs.allocated_bytes - hs.requested_bytes;
+        while (allocated >> 32) {
+            allocated >>= 1;
+            wasted >>= 1;
+        }
+        wasted *= 100;
+        divmod_u64(wasted, (uint32_t)allocated);
+        internal_pct = (uint32_t)wasted;
+    }
+    kprintf("Internal fragmentation: %u%% (lifetime)\n", internal_pct);
+    kprintf("Slabs: %zu pages, %zu KB free inside slabs; %u large blocks\n",
+            hs.slab_pages, hs.slab_free_bytes / 1024, hs.large_active);
+
+    // External fragmentation: how much of the free memory is not in the largest block.
+    size_t free_kb = pages_free_count() * (PAGE_SIZE / 1024);
+    int largest_order = pages_largest_free_order();
+    size_t largest_kb = largest_order >= 0 ? ((size_t)PAGE_SIZE << largest_order) / 1024 : 0;
+    kprintf("Pages: %zu KB free of %zu KB, largest block %zu KB",
+            free_kb, pages_total_count() * (PAGE_SIZE / 1024), largest_kb);
+    if (free_kb > 0) {
+        kprintf(" (external fragmentation %zu%%)", 100 - (largest_kb * 100) / free_kb);
+    }
+    kprintf(", %zu pages pre-zeroed\n", pages_zeroed_count());
+
+    kprintf("Command arena: %zu bytes used, %zu KB reserved\n",
+            command_arena.bytes_used(), command_arena.bytes_reserved() / 1024);
+
+    print_string("Cache              Size  Active  Allocs   Frees  Slabs\n", VGA_COLOR_LIGHT_CYAN);
+    heap_cache_stats cs;
+    for (int i = 0; heap_get_cache_stats(i, &cs); ++i) {
+        if (cs.allocs == 0) {
+            continue; // Never used, nothing to show
+        }
+        kprintf("%-16s%6zu%8u%8u%8u%7u\n", cs.name, cs.object_size, cs.active, cs.allocs, cs.frees, cs.slabs);
+    }
+
+    const int TOP_SITES = 5;
+    heap_site_stats sites[TOP_SITES];
+    int site_count = heap_get_top_sites(sites, TOP_SITES);
+    print_string("Top allocation sites (lifetime bytes):\n", VGA_COLOR_LIGHT_CYAN);
+    for (int i = 0; i < site_count; ++i) {
+        kprintf("  %#x%8u allocs%10zu bytes\n", (uint32_t)(uintptr_t)sites[i].site, sites[i].allocs, sites[i].bytes);
+    }
+    if (heap_dropped_sites() > 0) {
+        kprintf_color(VGA_COLOR_YELLOW, "  (%u allocations from untracked sites)\n", heap_dropped_sites());
+    }
+}
+
+// --- stacks command ---
+
+static void print_stacks() {
+    print_string("Stack            Size    Peak  Peak%     Now\n", VGA_COLOR_LIGHT_CYAN);
+    stack_usage su;
+    for (int i = 0; stack_get_usage(i, &su); ++i) {
+        uint32_t pct = su.size > 0 ? (uint32_t)((su.peak_used * 100) / su.size) : 0;
+        // Little headroom left: the stack should be made bigger.
+        int color = pct >= 75 ? VGA_COLOR_LIGHT_RED : VGA_COLOR_LIGHT_GREY;
+        kprintf_color(color, "%-12s%8zu%8zu%6u%%%8zu\n", su.name, su.size, su.peak_used, pct, su.used);
+    }
+}
+
+
+// --- Shell Commands ---
+// Every command is a handler taking the rest of the line (after the command
+// name and the spaces following it). 'scratch' is the per-command arena.
+typedef void (*command_handler)(string_view args, arena& scratch);
+
+struct shell_command {
+    const char* usage;       // As listed by 'help'; its first word is the command name
+    const char* description;
+    command_handler run;
+};
+
+static void cmd_help(string_view, arena&);
+
+static void cmd_cls(string_view, arena&) {
+    cls();
+}
+
+static void cmd_echo(string_view args, arena&) {
+    print_string(args, VGA_COLOR_WHITE);
+    print_char('\n');
+}
+
+static void cmd_calc(string_view args, arena&) {
+    size_t index = 0;
+    long long num1 = 0;
+    long long num2 = 0;
+    char op = 0;
+    long long result = 0;
+    bool error = false;
+
+    // Parse num1
+    num1 = simple_str_to_long(args, index);
+
+    // Skip spaces to find operator
+    while (index < args.size() && args[index] == ' ') {
+        index++;
+    }
+
+    // Parse operator
+    if (index < args.size()) {
+        op = args[index];
+        index++;
+    } else {
+        error = true;
+    }
+
+    // Skip spaces to find num2
+    while (index < args.size() && args[index] == ' ') {
+        index++;
+    }
+    
+    // Parse num2
+    if (!error && index < args.size()) {
+         // Check if the rest of the string after operator and spaces is a valid start for a number
+        if (args[index] >= '0' && args[index] <= '9' || args[index] == '-' || args[index] == '+') {
+            num2 = simple_str_to_long(args, index);
+        } else {
+            error = true; // Invalid character where num2 should start
+        }
+    } else if (!error) { // Reached end of input before num2
+         error = true;
+    }
+
+
+    // Perform calculation
+    if (!error) {
+        switch (op) {
+            case '+': result = num1 + num2; break;
+            case '-': result = num1 - num2; break;
+            case '*': result = num1 * num2; break;
+            case '/':
+                if (num2 == 0) {
+                    print_string("Error: Division by zero.\n", VGA_COLOR_LIGHT_RED);
+                    error = true;
+                } else {
+                    result = num1 / num2;
+                }
+                break;
+            default:
+                print_string("Error: Invalid operator '", VGA_COLOR_LIGHT_RED);
+                print_char(op, false, VGA_COLOR_LIGHT_RED);
+                print_string("'. Use +, -, *, /.\n", VGA_COLOR_LIGHT_RED);
+                error = true;
+                break;
+        }
+    }
+
+    if (!error) {
+        print_int(result);
+        print_char('\n');
+    } else {
+        if (op == 0 || (index == 0 && num1 == 0 && op ==0) ) { // Very basic check for insufficient args
+             print_string("Usage: calc <num1> <op> <num2>\n", VGA_COLOR_YELLOW);
+        }
+        // Specific error messages for operator/division by zero are printed above.
+    }
+}
+
+static void cmd_meminfo(string_view, arena& scratch) {
+    print_meminfo(scratch);
+}
+
+static void cmd_stacks(string_view, arena&) {
+    print_stacks();
+}
+
+static void cmd_dmesg(string_view args, arena&) {
+    int level = KLOG_DEBUG; // Everything by default
+    string_view name = args.next_word();
+    if (!name.empty()) {
+        level = klog_parse_level(name);
+        if (level < 0) {
+            print_string("Usage: dmesg [err|warn|info|debug]\n", VGA_COLOR_YELLOW);
+            return;
+        }
+    }
+    klog_dump(level);
+}
+
+static void cmd_reboot(string_view, arena&) {
+    acpi_reboot();
+    print_string("ACPI reboot sequence problem. System did not reboot.\n", VGA_COLOR_LIGHT_RED);
+    acpi_keyboard_reboot();
+    print_string("Reboot failed.\n", VGA_COLOR_LIGHT_RED);
+}
+
+static void cmd_shutdown(string_view, arena&) {
+    acpi_power_off();
+    print_string("ACPI shutdown sequence problem. System did not power off.\n", VGA_COLOR_LIGHT_RED);
+}
+
+// In the order 'help' lists them.
+static const shell_command shell_commands[] = {
+    { "help",                "Show this help message",                  cmd_help },
+    { "cls",                 "Clear the screen",                        cmd_cls },
+    { "echo [text]",         "Print [text] to the screen",              cmd_echo },
+    { "calc <n1> <op> <n2>", "Basic calculator (+, -, *, /)",           cmd_calc },
+    { "meminfo",             "Show heap and page allocator statistics", cmd_meminfo },
+    { "stacks",              "Show peak stack usage (high-water marks)", cmd_stacks },
+    { "dmesg [level]",       "Show the kernel log, up to [level]",      cmd_dmesg },
+    { "reboot",              "Reboot the system via ACPI S4",           cmd_reboot },
+    { "shutdown",            "Power off the system via ACPI S5",        cmd_shutdown },
+};
+
+#define SHELL_COMMAND_COUNT (sizeof(shell_commands) / sizeof(shell_commands[0]))
+#define HELP_USAGE_WIDTH 17
+
+static void cmd_help(string_view, arena&) {
+    print_string("Available commands:\n", VGA_COLOR_WHITE);
+    for (size_t i = 0; i < SHELL_COMMAND_COUNT; ++i) {
+        const shell_command& c = shell_commands[i];
+        print_string("  ", VGA_COLOR_WHITE);
+        print_string(c.usage, VGA_COLOR_WHITE);
+        // Pad the usage column; longer entries just get one space.
+        size_t len = str_length(c.usage);
+        for (size_t pad = len; pad < HELP_USAGE_WIDTH; ++pad) {
+            print_char(' ', false, VGA_COLOR_WHITE);
+        }
+        if (len >= HELP_USAGE_WIDTH) {
+            print_char(' ', false, VGA_COLOR_WHITE);
+        }
+        print_string("- ", VGA_COLOR_WHITE);
+        print_string(c.description, VGA_COLOR_WHITE);
+        print_char('\n');
+    }
+}
+
+
 // --- Kernel Entry Point ---
 extern "C" void kernel_main(multiboot_info* mbi) {
     cls();
+    klog_init(); // Log timestamps count from here
+
+    // First, so the serial console gets the whole boot log.
+    interrupts_init();
+    serial_init();
+    keyboard_init();
+    interrupts_enable();
+
+    // Must run before anything allocates, so the heap can grow into free RAM.
+    pages_init(mbi);
+    strings_self_check();
 
     print_string("Howdy! Welcome to Cinemint OS!\n", VGA_COLOR_LIGHT_CYAN);
     print_string("----------------------------------\n", VGA_COLOR_LIGHT_CYAN);
 
     print_string("Initializing ACPI...\n", VGA_COLOR_WHITE);
     acpi_init();
+    klog_drain(); // Show what ACPI discovery logged
     print_string("----------------------------------\n", VGA_COLOR_LIGHT_CYAN);
 
     if (mbi) {
         if (mbi->flags & (1 << 0)) {
-            print_string("Free Memory (Lower KB): ", VGA_COLOR_WHITE); print_int(mbi->mem_lower); print_string(" KB\n", VGA_COLOR_WHITE);
-            print_string("Free Memory (Upper KB): ", VGA_COLOR_WHITE); print_int(mbi->mem_upper); print_string(" KB\n", VGA_COLOR_WHITE);
-            print_string("Total Free Memory (Basic): ", VGA_COLOR_WHITE); print_int(mbi->mem_lower + mbi->mem_upper); print_string(" KB\n", VGA_COLOR_WHITE);
+            kprintf_color(VGA_COLOR_WHITE, "Free Memory (Lower KB): %u KB\n", mbi->mem_lower);
+            kprintf_color(VGA_COLOR_WHITE, "Free Memory (Upper KB): %u KB\n", mbi->mem_upper);
+            kprintf_color(VGA_COLOR_WHITE, "Total Free Memory (Basic): %u KB\n", mbi->mem_lower + mbi->mem_upper);
         }
         uint32_t ram_from_mmap = get_total_ram_mb(mbi);
         if (ram_from_mmap > 0) {
-             print_string("Total RAM from MMAP: ", VGA_COLOR_WHITE); print_int(ram_from_mmap); print_string(" MB\n", VGA_COLOR_WHITE);
+             kprintf_color(VGA_COLOR_WHITE, "Total RAM from MMAP: %u MB\n", ram_from_mmap);
         } else if (!(mbi->flags & (1 << 6))) { // Only print this if mmap flag wasn't set
             print_string("MMAP info not explicitly available via flags for detailed RAM count.\n", VGA_COLOR_YELLOW);
         }
+        kprintf_color(VGA_COLOR_WHITE, "Page allocator: %zu KB free\n", pages_free_count() * (PAGE_SIZE / 1024));
         print_char('\n');
     } else {
         print_string("Multiboot info not available (initial print).\n", VGA_COLOR_LIGHT_RED);
     }
 
+    // Boot is done: ACPI discovery and allocator setup will not run again.
+    size_t init_freed = free_init_memory();
+    kprintf_color(VGA_COLOR_WHITE, "Freed %zu KB of boot-only memory\n", init_freed / 1024);
+
     print_string("Type 'help' for available commands.\n\n", VGA_COLOR_WHITE);
 
-    vector<char> input_buffer;
+    small_vector<char, 80> input_buffer; // A full screen line (VGA_WIDTH) fits inline
+
+    // Scratch memory for a single shell command. Everything a command allocates
+    // here is dropped in one go when the command finishes, so commands do not
+    // have to free their temporaries one by one (pass &command_arena to vector).
+    // A local rather than a global: kernel_main never returns, and a global
+    // with a destructor would need atexit support.
+    arena command_arena;
     const char* prompt = "Cinemint> ";
 
+    // Command names are hashed once here; each line then costs a single
+    // lookup instead of a string compare against every command.
+    fixed_hash_map<string_view, const shell_command*, SHELL_COMMAND_COUNT> commands;
+    for (size_t i = 0; i < SHELL_COMMAND_COUNT; ++i) {
+        string_view usage(shell_commands[i].usage);
+        commands.insert(usage.next_word(), &shell_commands[i]);
+    }
+
     while (true) {
         print_string(prompt, VGA_COLOR_GREEN);
         input(input_buffer);
@@ -143,109 +382,17 @@ extern "C" void kernel_main(multiboot_info* mbi) {
             continue;
         }
 
-        if (streq_vec(input_buffer, "help")) {
-            print_string("Available commands:\n", VGA_COLOR_WHITE);
-            print_string("  help             - Show this help message\n", VGA_COLOR_WHITE);
-            print_string("  cls              - Clear the screen\n", VGA_COLOR_WHITE);
-            print_string("  echo [text]      - Print [text] to the screen\n", VGA_COLOR_WHITE);
-            print_string("  calc <n1> <op> <n2> - Basic calculator (+, -, *, /)\n", VGA_COLOR_WHITE); // Added calc
-            print_string("  reboot           - Reboot the system via ACPI S4\n", VGA_COLOR_WHITE);
-            print_string("  shutdown         - Power off the system via ACPI S5\n", VGA_COLOR_WHITE);
-        } else if (streq_vec(input_buffer, "cls")) {
-            cls();
-        } else if (strstarts_vec(input_buffer, "echo ")) {
-            if (input_buffer.size() > 5) {
-                print_vector_char_range(input_buffer, 5, VGA_COLOR_WHITE);
-                print_char('\n');
-            } else {
-                print_char('\n');
-            }
-        } else if (strstarts_vec(input_buffer, "calc ")) {
-            size_t index = 5; // Start parsing after "calc "
-            long long num1 = 0;
-            long long num2 = 0;
-            char op = 0;
-            long long result = 0;
-            bool error = false;
-
-            // Parse num1
-            num1 = simple_str_to_long(input_buffer, index);
-
-            // Skip spaces to find operator
-            while (index < input_buffer.size() && input_buffer[index] == ' ') {
-                index++;
-            }
-
-            // Parse operator
-            if (index < input_buffer.size()) {
-                op = input_buffer[index];
-                index++;
-            } else {
-                error = true;
-            }
-
-            // Skip spaces to find num2
-            while (index < input_buffer.size() && input_buffer[index] == ' ') {
-                index++;
-            }
-            
-            // Parse num2
-            if (!error && index < input_buffer.size()) {
-                 // Check if the rest of the string after operator and spaces is a valid start for a number
-                if (input_buffer[index] >= '0' && input_buffer[index] <= '9' || input_buffer[index] == '-' || input_buffer[index] == '+') {
-                    num2 = simple_str_to_long(input_buffer, index);
-                } else {
-                    error = true; // Invalid character where num2 should start
-                }
-            } else if (!error) { // Reached end of input before num2
-                 error = true;
-            }
-
-
-            // Perform calculation
-            if (!error) {
-                switch (op) {
-                    case '+': result = num1 + num2; break;
-                    case '-': result = num1 - num2; break;
-                    case '*': result = num1 * num2; break;
-                    case '/':
-                        if (num2 == 0) {
-                            print_string("Error: Division by zero.\n", VGA_COLOR_LIGHT_RED);
-                            error = true;
-                        } else {
-                            result = num1 / num2;
-                        }
-                        break;
-                    default:
-                        print_string("Error: Invalid operator '", VGA_COLOR_LIGHT_RED);
-                        print_char(op, false, VGA_COLOR_LIGHT_RED);
-                        print_string("'. Use +, -, *, /.\n", VGA_COLOR_LIGHT_RED);
-                        error = true;
-                        break;
-                }
-            }
-
-            if (!error) {
-                print_int(result);
-                print_char('\n');
-            } else {
-                if (op == 0 || (index <= 5 && num1 == 0 && op ==0) ) { // Very basic check for insufficient args
-                     print_string("Usage: calc <num1> <op> <num2>\n", VGA_COLOR_YELLOW);
-                }
-                // Specific error messages for operator/division by zero are printed above.
-            }
-
-        } else if (streq_vec(input_buffer, "shutdown")) {
-            acpi_power_off();
-            print_string("ACPI shutdown sequence problem. System did not power off.\n", VGA_COLOR_LIGHT_RED);
-        } else if (streq_vec(input_buffer, "reboot")) {
-            acpi_reboot();
-            print_string("ACPI reboot sequence problem. System did not reboot.\n", VGA_COLOR_LIGHT_RED);
-            acpi_keyboard_reboot();
-            print_string("Reboot failed.\n", VGA_COLOR_LIGHT_RED);
-        } else {
+        // Rewinds the command arena once this command is done.
+        arena_scope command_scope(command_arena);
+
+        string_view args(input_buffer);
+        string_view name = args.next_word();
+        const shell_command* const* command = commands.find(name);
+        if (command) {
+            (*command)->run(args, command_arena);
+        } else if (!name.empty()) {
             print_string("Unknown command: ", VGA_COLOR_LIGHT_RED);
-            print_vector_char_range(input_buffer, 0, VGA_COLOR_LIGHT_RED);
+            print_string(string_view(input_buffer), VGA_COLOR_LIGHT_RED);
             print_char('\n');
         }
     }
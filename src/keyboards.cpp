@@ -0,0 +1,120 @@
+#include "include/keyboards.h"
+#include "include/consts.h"     // For KEY_EXTENDED
+#include "include/rings.h"      // For the scancode ring
+#include "include/interrupts.h" // For IRQ 1
+#include "include/io.h"         // For inb/outb
+#include "include/inits.h"      // For INIT_CODE
+
+// --- PS/2 Controller ---
+#define PS2_DATA    0x60
+#define PS2_STATUS  0x64 // Read
+#define PS2_COMMAND 0x64 // Write
+
+#define PS2_STATUS_OUTPUT_FULL 0x01 // A byte waits in PS2_DATA
+#define PS2_STATUS_INPUT_FULL  0x02 // The controller has not taken the last command yet
+#define PS2_STATUS_AUX_DATA    0x20 // The waiting byte is from the mouse port
+
+#define PS2_READ_CONFIG  0x20
+#define PS2_WRITE_CONFIG 0x60
+#define PS2_CONFIG_KEYBOARD_IRQ 0x01
+
+#define PS2_TIMEOUT 100000 // Status polls before giving up (init only)
+
+// --- Scancode Prefixes ---
+#define SCANCODE_EXTENDED 0xE0 // The next byte is an extended key
+#define SCANCODE_PAUSE    0xE1 // Pause: E1 1D 45 E1 9D C5, no release
+#define PAUSE_LENGTH      6
+#define SCANCODE_ERROR    0x00 // Key detection error
+#define SCANCODE_OVERRUN  0xFF // The keyboard's own buffer overflowed
+
+static ring_buffer<uint8_t, KEYBOARD_BUFFER_SIZE> scancodes;
+
+// Decoder state (normal code only)
+static bool extended_pending = false;
+static int pause_remaining = 0; // Bytes of a Pause sequence still to swallow
+
+static void keyboard_irq() {
+    uint8_t status = inb(PS2_STATUS);
+    if (!(status & PS2_STATUS_OUTPUT_FULL)) {
+        return;
+    }
+    uint8_t byte = inb(PS2_DATA); // Read even when dropped, or the controller stalls
+    if (!(status & PS2_STATUS_AUX_DATA)) {
+        scancodes.push(byte); // A full ring drops the byte
+    }
+}
+
+INIT_CODE static bool ps2_wait_input_empty() {
+    for (int i = 0; i < PS2_TIMEOUT; ++i) {
+        if (!(inb(PS2_STATUS) & PS2_STATUS_INPUT_FULL)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+INIT_CODE static bool ps2_wait_output_full() {
+    for (int i = 0; i < PS2_TIMEOUT; ++i) {
+        if (inb(PS2_STATUS) & PS2_STATUS_OUTPUT_FULL) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// --- Keyboard Function Definitions ---
+
+INIT_CODE void keyboard_init() {
+    // Drop anything typed (or left over) before the handler existed.
+    while (inb(PS2_STATUS) & PS2_STATUS_OUTPUT_FULL) {
+        inb(PS2_DATA);
+    }
+
+    // The firmware normally leaves the keyboard interrupt on; make sure.
+    if (ps2_wait_input_empty()) {
+        outb(PS2_COMMAND, PS2_READ_CONFIG);
+        if (ps2_wait_output_full()) {
+            uint8_t config = inb(PS2_DATA);
+            if (!(config & PS2_CONFIG_KEYBOARD_IRQ) && ps2_wait_input_empty()) {
+                outb(PS2_COMMAND, PS2_WRITE_CONFIG);
+                if (ps2_wait_input_empty()) {
+                    outb(PS2_DATA, config | PS2_CONFIG_KEYBOARD_IRQ);
+                }
+            }
+        }
+    }
+
+    irq_install_handler(IRQ_KEYBOARD, keyboard_irq);
+}
+
+uint16_t keyboard_get_key() {
+    uint8_t byte;
+    while (scancodes.pop(byte)) {
+        if (byte == SCANCODE_ERROR || byte == SCANCODE_OVERRUN) {
+            continue;
+        }
+        if (pause_remaining > 0) {
+            pause_remaining--;
+            continue;
+        }
+        if (byte == SCANCODE_PAUSE) {
+            pause_remaining = PAUSE_LENGTH - 1; // Pause has no use here: skip it
+            continue;
+        }
+        if (byte == SCANCODE_EXTENDED) {
+            extended_pending = true;
+            continue;
+        }
+        uint16_t key = byte;
+        if (extended_pending) {
+            key |= KEY_EXTENDED;
+            extended_pending = false;
+        }
+        return key;
+    }
+    return KEY_NONE;
+}
+
+bool keyboard_has_data() {
+    return !scancodes.empty();
+}
@@ -0,0 +1,161 @@
+#include "include/logs.h"
+#include "include/io.h"     // For outb/inb (PIT)
+#include "include/inits.h"  // For INIT_CODE
+#include "include/consts.h" // For VGA_COLOR_*
+
+// --- Log Records ---
+struct klog_record {
+    uint32_t seq;          // Sequence number + 1 once complete; 0 while being written
+    uint8_t level;
+    uint8_t len;           // Bytes of 'text' used (no terminator)
+    uint16_t reserved;
+    uint64_t tsc;
+    const char* subsystem;
+    char text[KLOG_TEXT_MAX];
+};
+
+static_assert(sizeof(klog_record) == 128, "klog records are 128 bytes");
+static_assert((KLOG_RECORDS & (KLOG_RECORDS - 1)) == 0, "KLOG_RECORDS must be a power of two");
+static_assert(KLOG_TEXT_MAX <= 255, "klog_record::len is one byte");
+
+static klog_record records[KLOG_RECORDS];
+static uint32_t klog_head = 0;    // Sequence number of the next record to be claimed
+static uint32_t console_next = 0; // First record klog_drain() has not looked at
+static uint64_t boot_tsc = 0;
+static uint32_t tsc_per_us = 0;   // 0 until klog_init() measured it
+
+static const char* const level_names[] = { "err", "warn", "info", "debug" };
+static const int level_colors[] = { VGA_COLOR_LIGHT_RED, VGA_COLOR_YELLOW, VGA_COLOR_WHITE, VGA_COLOR_LIGHT_GREY };
+
+// --- TSC Calibration ---
+// PIT channel 2 (the speaker channel, whose output can be read back in port
+// 0x61) counts down from PIT_CALIBRATE_COUNT in mode 0; the TSC cycles that
+// pass meanwhile give the rate.
+#define PIT_FREQUENCY       1193182
+#define PIT_CALIBRATE_MS    10
+#define PIT_CALIBRATE_COUNT (PIT_FREQUENCY * PIT_CALIBRATE_MS / 1000)
+#define PIT_CHANNEL2        0x42
+#define PIT_COMMAND         0x43
+#define PORT_SPEAKER        0x61 // Bit 0: channel 2 gate, bit 1: speaker on, bit 5: channel 2 output
+
+INIT_CODE void klog_init() {
+    uint8_t speaker = inb(PORT_SPEAKER);
+    outb(PORT_SPEAKER, (speaker & ~0x02) | 0x01); // Gate on, speaker off
+    outb(PIT_COMMAND, 0xB0);                      // Channel 2, lobyte/hibyte, mode 0
+    outb(PIT_CHANNEL2, PIT_CALIBRATE_COUNT & 0xFF);
+    outb(PIT_CHANNEL2, PIT_CALIBRATE_COUNT >> 8);
+
+    uint64_t start = rdtsc();
+    while (!(inb(PORT_SPEAKER) & 0x20)) {
+        // Output goes high when the count reaches zero
+    }
+    uint64_t end = rdtsc();
+    outb(PORT_SPEAKER, speaker);
+
+    // 10 ms of cycles fit 32 bits below 400 GHz.
+    tsc_per_us = (uint32_t)(end - start) / (PIT_CALIBRATE_MS * 1000);
+    boot_tsc = start; // Timestamps count from here
+}
+
+// --- Writing ---
+
+void klog(int level, const char* subsystem, const char* fmt, ...) {
+    uint64_t now = rdtsc();
+    uint32_t seq = __atomic_fetch_add(&klog_head, 1, __ATOMIC_RELAXED);
+    klog_record& r = records[seq & (KLOG_RECORDS - 1)];
+
+    // Mark the record incomplete before touching it, so a reader that is
+    // copying its previous contents sees the change and drops its copy.
+    __atomic_store_n(&r.seq, 0, __ATOMIC_RELAXED);
+    __atomic_thread_fence(__ATOMIC_RELEASE);
+
+    va_list args;
+    va_start(args, fmt);
+    int n = kvsnprintf(r.text, KLOG_TEXT_MAX, fmt, args); // Stack only: safe in an ISR
+    va_end(args);
+    if (n > KLOG_TEXT_MAX - 1) {
+        n = KLOG_TEXT_MAX - 1;
+    }
+    while (n > 0 && r.text[n - 1] == '\n') {
+        n--;
+    }
+
+    r.level = (uint8_t)(level < KLOG_ERR ? KLOG_ERR : level > KLOG_DEBUG ? KLOG_DEBUG : level);
+    r.len = (uint8_t)n;
+    r.tsc = now;
+    r.subsystem = subsystem;
+    __atomic_store_n(&r.seq, seq + 1, __ATOMIC_RELEASE); // Publish
+}
+
+// --- Reading ---
+
+// Copies record 'seq' into 'out'. Fails if it was overwritten (or is being
+// written) meanwhile; the copy is checked afterwards, like a seqlock.
+static bool read_record(uint32_t seq, klog_record& out) {
+    const klog_record& r = records[seq & (KLOG_RECORDS - 1)];
+    if (__atomic_load_n(&r.seq, __ATOMIC_ACQUIRE) != seq + 1) {
+        return false;
+    }
+    out.level = r.level;
+    out.len = r.len;
+    out.tsc = r.tsc;
+    out.subsystem = r.subsystem;
+    memcpy(out.text, r.text, r.len);
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    return __atomic_load_n(&r.seq, __ATOMIC_RELAXED) == seq + 1;
+}
+
+// Oldest sequence number that can still be in the ring
+static uint32_t oldest_seq(uint32_t head) {
+    return head > KLOG_RECORDS ? head - KLOG_RECORDS : 0;
+}
+
+static void print_record(const klog_record& r, bool timestamp) {
+    int color = level_colors[r.level];
+    if (timestamp) {
+        uint64_t t = r.tsc > boot_tsc ? r.tsc - boot_tsc : 0;
+        if (tsc_per_us) {
+            divmod_u64(t, tsc_per_us);          // Microseconds
+            uint32_t us = divmod_u64(t, 1000000); // Seconds
+            kprintf_color(color, "[%5u.%06u] ", (uint32_t)t, us);
+        } else {
+            kprintf_color(color, "[%llu] ", t); // Not calibrated: raw cycles
+        }
+    }
+    kprintf_color(color, "%s: %.*s\n", r.subsystem, (int)r.len, r.text);
+}
+
+void klog_drain() {
+    uint32_t head = __atomic_load_n(&klog_head, __ATOMIC_ACQUIRE);
+    uint32_t first = oldest_seq(head);
+    if ((int32_t)(first - console_next) > 0) {
+        kprintf_color(VGA_COLOR_YELLOW, "klog: %u messages lost\n", first - console_next);
+        console_next = first;
+    }
+
+    klog_record r;
+    for (; console_next != head; ++console_next) {
+        if (read_record(console_next, r) && r.level <= KLOG_CONSOLE_LEVEL) {
+            print_record(r, false);
+        }
+    }
+}
+
+void klog_dump(int max_level) {
+    uint32_t head = __atomic_load_n(&klog_head, __ATOMIC_ACQUIRE);
+    klog_record r;
+    for (uint32_t seq = oldest_seq(head); seq != head; ++seq) {
+        if (read_record(seq, r) && r.level <= max_level) {
+            print_record(r, true);
+        }
+    }
+}
+
+int klog_parse_level(string_view name) {
+    for (int level = KLOG_ERR; level <= KLOG_DEBUG; ++level) {
+        if (name == string_view(level_names[level])) {
+            return level;
+        }
+    }
+    return -1;
+}
@@ -1,66 +1,697 @@
 #include "include/memorys.h"
+#include "include/pages.h"
+#include "include/caches.h"
+#include "include/inits.h"
 // Potentially include "io.h" if you need print_string for debugging in here.
 // #include "include/io.h"
 
 // --- Custom Memory Allocator Definitions ---
 // Define the actual memory pool and its size.
 // The 'alignas(16)' can be useful if you allocate types that need specific alignment.
-alignas(16) char memory_pool[1024 * 1024]; // 1MB pool
-size_t pool_index = 0; // Initialized to 0
+// The pool is handed to the page allocator when the bootloader gives no usable
+// memory map, so it is page-aligned.
+alignas(4096) char memory_pool[MEMORY_POOL_BYTES]; // 1MB pool
 
-// Max size for the pool, can be used for boundary check
-const size_t MEMORY_POOL_SIZE = sizeof(memory_pool);
+// --- Freestanding Memory Primitives ---
+// String instructions keep these short and stop GCC from turning the loops back
+// into calls to the very functions being defined.
 
-void* operator new[](size_t size) noexcept {
-    // Basic alignment: ensure pool_index is aligned to a multiple of a common alignment (e.g., 16 or sizeof(void*))
-    // This is a very simple alignment strategy.
-    size_t alignment = 16; // Or sizeof(void*)
-    size_t remainder = pool_index % alignment;
-    if (remainder != 0) {
-        pool_index += (alignment - remainder);
+extern "C" void* memset(void* dest, int value, size_t count) {
+    void* d = dest;
+    asm volatile("rep stosb" : "+D"(d), "+c"(count) : "a"(value) : "memory");
+    return dest;
+}
+
+extern "C" void* memcpy(void* dest, const void* src, size_t count) {
+    void* d = dest;
+    size_t dwords = count >> 2;
+    size_t bytes = count & 3;
+    asm volatile("rep movsl" : "+D"(d), "+S"(src), "+c"(dwords) : : "memory");
+    asm volatile("rep movsb" : "+D"(d), "+S"(src), "+c"(bytes) : : "memory");
+    return dest;
+}
+
+extern "C" void* memmove(void* dest, const void* src, size_t count) {
+    if ((uintptr_t)dest <= (uintptr_t)src || (uintptr_t)dest >= (uintptr_t)src + count) {
+        return memcpy(dest, src, count); // No harmful overlap: copy forwards
     }
+    // Overlapping with dest above src: copy backwards, starting from the last byte.
+    void* d = (char*)dest + count - 1;
+    const void* s = (const char*)src + count - 1;
+    asm volatile("std\n\trep movsb\n\tcld" : "+D"(d), "+S"(s), "+c"(count) : : "memory");
+    return dest;
+}
 
-    if (pool_index + size > MEMORY_POOL_SIZE) {
-        // Optional: print an out-of-memory message if print functions are available
-        // print_string("Kernel heap out of memory (new[])!\n", VGA_COLOR_LIGHT_RED);
-        return nullptr; // Out of memory
+extern "C" int memcmp(const void* ptr1, const void* ptr2, size_t count) {
+    const unsigned char* p1 = (const unsigned char*)ptr1;
+    const unsigned char* p2 = (const unsigned char*)ptr2;
+    for (size_t i = 0; i < count; ++i) {
+        if (p1[i] != p2[i]) {
+            return p1[i] < p2[i] ? -1 : 1;
+        }
     }
-    void* ptr = &memory_pool[pool_index];
-    pool_index += size;
-    return ptr;
+    return 0;
 }
 
-void operator delete[](void* ptr) noexcept {
-    // For a simple bump allocator, delete is usually a no-op.
-    // More advanced allocators would free the memory here.
-    (void)ptr; // Suppress unused parameter warning
+// --- Kernel Heap ---
+// Segregated-fit slab allocator on top of the page allocator.
+// Requests up to SLAB_MAX_OBJECT bytes are rounded up to a size class. Each class
+// is a kmem_cache that carves 4 KiB slabs into equal objects; a slab header at
+// the start of the page holds its own free list, so kfree() finds everything it
+// needs by masking the pointer down to the page boundary. Larger requests get
+// their own block of pages with a small header in front.
+// Object caches created with kmem_cache_create() use the same slab code.
+
+#define SLAB_MAGIC  0x534C4142 // "SLAB"
+#define LARGE_MAGIC 0x4C415247 // "LARG"
+#define HEAP_ALIGN  16
+#define SLAB_MAX_OBJECT 1024
+
+struct slab {
+    uint32_t magic;
+    kmem_cache* cache;
+    slab* next;         // Links in the cache's partial list
+    slab* prev;
+    void* free_list;    // Free objects of this slab, linked through cache->link_offset
+    uint16_t in_use;
+    uint16_t capacity;
+};
+
+// Objects start after the header, rounded up to keep them 16-byte aligned.
+#define SLAB_HEADER_SIZE ((sizeof(slab) + HEAP_ALIGN - 1) & ~(size_t)(HEAP_ALIGN - 1))
+
+struct large_header {
+    uint32_t magic;
+    uint32_t order;     // Order of the page block
+    uint32_t size;      // Requested size
+    uint32_t reserved;  // Pads the header to 16 bytes
+};
+
+struct kmem_cache {
+    const char* name;
+    size_t object_size;   // Size the user asked for
+    size_t stride;        // Distance between two objects in a slab
+    size_t first_offset;  // Offset of the first object from the start of the slab
+    size_t link_offset;   // Where a free object stores its free-list link
+    uint16_t capacity;    // Objects per slab
+    void (*ctor)(void*);  // Run once per object when its slab is created
+    slab* partial;        // Slabs with at least one free object (full slabs are unlinked)
+    slab* spare;          // One completely free slab kept back to avoid page churn
+    kmem_cache* next;     // Chain of caches made by kmem_cache_create()
+
+    // Statistics
+    uint32_t active;      // Objects currently handed out
+    uint32_t allocs;
+    uint32_t frees;
+    uint32_t slabs;       // Slabs (pages) currently owned, including the spare
+};
+
+static const size_t size_classes[] = { 16, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024 };
+static const char* const size_class_names[] = {
+    "kmalloc-16", "kmalloc-32", "kmalloc-48", "kmalloc-64", "kmalloc-96", "kmalloc-128",
+    "kmalloc-192", "kmalloc-256", "kmalloc-384", "kmalloc-512", "kmalloc-768", "kmalloc-1024",
+};
+const int SIZE_CLASS_COUNT = sizeof(size_classes) / sizeof(size_classes[0]);
+
+static kmem_cache caches[SIZE_CLASS_COUNT];
+// Maps (size + 15) / 16 to a size class, so class lookup is a single load.
+static uint8_t class_index[SLAB_MAX_OBJECT / HEAP_ALIGN + 1];
+static bool heap_ready = false;
+static kmem_cache* user_caches = nullptr;
+
+// --- Heap Statistics ---
+// Cheap counters kept on every allocation, read by the 'meminfo' command.
+
+static heap_stats stats;
+
+// Call sites are keyed by return address in a small open-addressing table.
+// Sites arriving once the table is full are only counted in sites_dropped.
+#define SITE_TABLE_SIZE 64
+static heap_site_stats site_table[SITE_TABLE_SIZE];
+static uint32_t sites_dropped = 0;
+
+static void record_site(void* site, size_t bytes) {
+    uint32_t slot = ((uint32_t)(uintptr_t)site * 2654435761u) >> 26; // Top 6 bits: 0..63
+    for (int probe = 0; probe < SITE_TABLE_SIZE; ++probe) {
+        heap_site_stats& entry = site_table[slot];
+        if (entry.site == site) {
+            entry.allocs++;
+            entry.bytes += bytes;
+            return;
+        }
+        if (entry.site == nullptr) {
+            entry.site = site;
+            entry.allocs = 1;
+            entry.bytes = bytes;
+            return;
+        }
+        slot = (slot + 1) & (SITE_TABLE_SIZE - 1);
+    }
+    sites_dropped++;
 }
 
-// If you added declarations for non-array new/delete in the header:
-/*
-void* operator new(size_t size) noexcept {
-    size_t alignment = 16;
-    size_t remainder = pool_index % alignment;
-    if (remainder != 0) {
-        pool_index += (alignment - remainder);
+static void account_alloc(void* site, size_t requested, size_t allocated) {
+    stats.alloc_count++;
+    stats.requested_bytes += requested;
+    stats.allocated_bytes += allocated;
+    stats.bytes_in_use += allocated;
+    if (stats.bytes_in_use > stats.peak_bytes) {
+        stats.peak_bytes = stats.bytes_in_use;
     }
+    record_site(site, allocated);
+}
 
-    if (pool_index + size > MEMORY_POOL_SIZE) {
+// An allocation grew in place by 'grown' bytes (see kexpand()).
+static void account_grow(size_t grown) {
+    stats.allocated_bytes += grown;
+    stats.bytes_in_use += grown;
+    if (stats.bytes_in_use > stats.peak_bytes) {
+        stats.peak_bytes = stats.bytes_in_use;
+    }
+}
+
+static void account_free(size_t allocated) {
+    stats.free_count++;
+    stats.bytes_in_use -= allocated;
+}
+
+static inline size_t align_up(size_t value, size_t align) {
+    return (value + align - 1) & ~(align - 1);
+}
+
+// Fills in the layout of a cache. Returns false if not even one object fits in a slab.
+static bool cache_setup(kmem_cache* cache, const char* name, size_t size, size_t align, void (*ctor)(void*)) {
+    if (align < sizeof(void*)) {
+        align = sizeof(void*);
+    }
+    cache->name = name;
+    cache->object_size = size;
+    cache->ctor = ctor;
+    if (ctor) {
+        // Constructed objects must survive being freed, so the link goes after the object.
+        cache->link_offset = align_up(size, sizeof(void*));
+        cache->stride = align_up(cache->link_offset + sizeof(void*), align);
+    } else {
+        cache->link_offset = 0;
+        cache->stride = align_up(size < sizeof(void*) ? sizeof(void*) : size, align);
+    }
+    cache->first_offset = align_up(SLAB_HEADER_SIZE, align);
+    if (cache->first_offset + cache->stride > PAGE_SIZE) {
+        return false;
+    }
+    cache->capacity = (uint16_t)((PAGE_SIZE - cache->first_offset) / cache->stride);
+    cache->partial = nullptr;
+    cache->spare = nullptr;
+    cache->next = nullptr;
+    cache->active = cache->allocs = cache->frees = cache->slabs = 0;
+    return true;
+}
+
+static void heap_init() {
+    int cls = 0;
+    for (size_t i = 0; i <= SLAB_MAX_OBJECT / HEAP_ALIGN; ++i) {
+        while (size_classes[cls] < i * HEAP_ALIGN) {
+            cls++;
+        }
+        class_index[i] = (uint8_t)cls;
+    }
+    for (int i = 0; i < SIZE_CLASS_COUNT; ++i) {
+        cache_setup(&caches[i], size_class_names[i], size_classes[i], HEAP_ALIGN, nullptr);
+    }
+    heap_ready = true;
+}
+
+static inline void*& free_link(const kmem_cache* cache, void* obj) {
+    return *(void**)((char*)obj + cache->link_offset);
+}
+
+static void partial_push(kmem_cache* cache, slab* s) {
+    s->prev = nullptr;
+    s->next = cache->partial;
+    if (cache->partial) {
+        cache->partial->prev = s;
+    }
+    cache->partial = s;
+}
+
+static void partial_remove(kmem_cache* cache, slab* s) {
+    if (s->prev) {
+        s->prev->next = s->next;
+    } else {
+        cache->partial = s->next;
+    }
+    if (s->next) {
+        s->next->prev = s->prev;
+    }
+    s->next = s->prev = nullptr;
+}
+
+static slab* slab_create(kmem_cache* cache) {
+    slab* s = (slab*)pages_alloc(0);
+    if (!s) {
+        return nullptr;
+    }
+    s->magic = SLAB_MAGIC;
+    s->cache = cache;
+    s->next = s->prev = nullptr;
+    s->in_use = 0;
+    s->capacity = cache->capacity;
+
+    // Construct every object and thread the free list through them, lowest address first.
+    char* first = (char*)s + cache->first_offset;
+    void* next = nullptr;
+    for (int i = cache->capacity - 1; i >= 0; --i) {
+        char* obj = first + i * cache->stride;
+        if (cache->ctor) {
+            cache->ctor(obj);
+        }
+        free_link(cache, obj) = next;
+        next = obj;
+    }
+    s->free_list = next;
+    cache->slabs++;
+    return s;
+}
+
+static void* slab_alloc(kmem_cache* cache) {
+    slab* s = cache->partial;
+    if (!s) {
+        if (cache->spare) {
+            s = cache->spare;
+            cache->spare = nullptr;
+        } else {
+            s = slab_create(cache);
+            if (!s) {
+                return nullptr;
+            }
+        }
+        partial_push(cache, s);
+    }
+
+    void* obj = s->free_list;
+    s->free_list = free_link(cache, obj);
+    s->in_use++;
+    cache->active++;
+    cache->allocs++;
+    if (!s->free_list) {
+        partial_remove(cache, s); // Now full: only frees can bring it back
+    }
+    return obj;
+}
+
+static void slab_free(slab* s, void* obj) {
+    kmem_cache* cache = s->cache;
+    if (!s->free_list) {
+        partial_push(cache, s); // Was full, has room again
+    }
+    free_link(cache, obj) = s->free_list;
+    s->free_list = obj;
+    s->in_use--;
+    cache->active--;
+    cache->frees++;
+
+    if (s->in_use == 0) {
+        partial_remove(cache, s);
+        if (!cache->spare) {
+            cache->spare = s;
+        } else {
+            s->magic = 0;
+            cache->slabs--;
+            pages_free(s);
+        }
+    }
+}
+
+static void* large_alloc(size_t size, bool zeroed) {
+    unsigned int order = pages_order_for(size + sizeof(large_header));
+    large_header* h = (large_header*)(zeroed ? pages_alloc_zeroed(order) : pages_alloc(order));
+    if (!h) {
+        return nullptr;
+    }
+    h->magic = LARGE_MAGIC;
+    h->order = order;
+    h->size = size;
+    stats.large_active++;
+    return h + 1;
+}
+
+// 'site' is the caller's return address, recorded for the call-site histogram.
+static void* heap_alloc(size_t size, void* site, bool zeroed = false) {
+    if (!heap_ready) {
+        heap_init();
+    }
+    if (size == 0) {
+        size = 1;
+    }
+    void* ptr;
+    size_t allocated;
+    if (size <= SLAB_MAX_OBJECT) {
+        kmem_cache* cache = &caches[class_index[(size + HEAP_ALIGN - 1) / HEAP_ALIGN]];
+        ptr = slab_alloc(cache);
+        allocated = cache->object_size;
+        if (ptr && zeroed) {
+            memset(ptr, 0, size);
+        }
+    } else {
+        ptr = large_alloc(size, zeroed);
+        allocated = ptr ? (size_t)PAGE_SIZE << ((large_header*)ptr - 1)->order : 0;
+    }
+    if (!ptr) {
+        stats.failed_count++;
         return nullptr;
     }
-    void* ptr = &memory_pool[pool_index];
-    pool_index += size;
+    account_alloc(site, size, allocated);
     return ptr;
 }
 
+void* kmalloc(size_t size) {
+    return heap_alloc(size, __builtin_return_address(0));
+}
+
+void* kzalloc(size_t size) {
+    return heap_alloc(size, __builtin_return_address(0), true);
+}
+
+void kfree(void* ptr) {
+    if (!ptr) {
+        return;
+    }
+    // Both slab objects and large blocks have their header at the start of the page.
+    void* page = (void*)((uintptr_t)ptr & ~(uintptr_t)(PAGE_SIZE - 1));
+    uint32_t magic = *(uint32_t*)page;
+    if (magic == SLAB_MAGIC) {
+        slab* s = (slab*)page;
+        account_free(s->cache->object_size);
+        slab_free(s, ptr);
+    } else if (magic == LARGE_MAGIC && ptr == (large_header*)page + 1) {
+        large_header* h = (large_header*)page;
+        account_free((size_t)PAGE_SIZE << h->order);
+        stats.large_active--;
+        h->magic = 0;
+        pages_free(page);
+    }
+    // Anything else is not a heap pointer and is ignored.
+}
+
+static void* heap_alloc_aligned(size_t size, size_t align, void* site) {
+    if (align <= HEAP_ALIGN) {
+        return heap_alloc(size, site);
+    }
+    if (align >= PAGE_SIZE) {
+        // Buddy blocks are aligned to their own size, so a large enough block is aligned too.
+        unsigned int order = pages_order_for(size > align ? size : align);
+        void* block = pages_alloc(order);
+        if (!block) {
+            stats.failed_count++;
+            return nullptr;
+        }
+        account_alloc(site, size, (size_t)PAGE_SIZE << order);
+        return block;
+    }
+    // Over-allocate, and keep the original pointer in the word just below the aligned one.
+    void* raw = heap_alloc(size + align, site);
+    if (!raw) {
+        return nullptr;
+    }
+    uintptr_t aligned = ((uintptr_t)raw + sizeof(void*) + align - 1) & ~(uintptr_t)(align - 1);
+    ((void**)aligned)[-1] = raw;
+    return (void*)aligned;
+}
+
+// --- In-Place Growth ---
+
+static bool heap_expand(void* ptr, size_t new_size) {
+    void* page = (void*)((uintptr_t)ptr & ~(uintptr_t)(PAGE_SIZE - 1));
+    uint32_t magic = *(uint32_t*)page;
+    if (magic == SLAB_MAGIC) {
+        // Objects never change slab, only the unused rest of the slot is free.
+        slab* s = (slab*)page;
+        return new_size <= s->cache->object_size;
+    }
+    if (magic != LARGE_MAGIC || ptr != (large_header*)page + 1) {
+        return false;
+    }
+
+    large_header* h = (large_header*)page;
+    size_t old_bytes = (size_t)PAGE_SIZE << h->order;
+    unsigned int order = pages_order_for(new_size + sizeof(large_header));
+    if (order > h->order) {
+        if (!pages_expand(page, order)) {
+            return false;
+        }
+        size_t grown = ((size_t)PAGE_SIZE << order) - old_bytes;
+        h->order = order;
+        account_grow(grown);
+    }
+    if (new_size > h->size) {
+        stats.requested_bytes += new_size - h->size;
+        h->size = new_size;
+    }
+    return true;
+}
+
+bool kexpand(void* ptr, size_t new_size) {
+    return ptr && heap_expand(ptr, new_size);
+}
+
+bool kexpand_aligned(void* ptr, size_t new_size, size_t align) {
+    if (!ptr) {
+        return false;
+    }
+    if (align <= HEAP_ALIGN) {
+        return heap_expand(ptr, new_size);
+    }
+    if (align >= PAGE_SIZE) {
+        int order = pages_order_of(ptr);
+        if (order < 0) {
+            return false;
+        }
+        unsigned int new_order = pages_order_for(new_size);
+        if (new_order <= (unsigned int)order) {
+            return true;
+        }
+        if (!pages_expand(ptr, new_order)) {
+            return false;
+        }
+        size_t grown = ((size_t)PAGE_SIZE << new_order) - ((size_t)PAGE_SIZE << order);
+        account_grow(grown);
+        return true;
+    }
+    // The aligned pointer sits inside a bigger kmalloc() block; grow that one.
+    void* raw = ((void**)ptr)[-1];
+    return heap_expand(raw, new_size + ((uintptr_t)ptr - (uintptr_t)raw));
+}
+
+void* kmalloc_aligned(size_t size, size_t align) {
+    return heap_alloc_aligned(size, align, __builtin_return_address(0));
+}
+
+void kfree_aligned(void* ptr, size_t align) {
+    if (!ptr) {
+        return;
+    }
+    if (align <= HEAP_ALIGN) {
+        kfree(ptr);
+    } else if (align >= PAGE_SIZE) {
+        int order = pages_order_of(ptr);
+        if (order >= 0) {
+            account_free((size_t)PAGE_SIZE << order);
+            pages_free(ptr);
+        }
+    } else {
+        kfree(((void**)ptr)[-1]);
+    }
+}
+
+// --- Object Caches ---
+
+kmem_cache* kmem_cache_create(const char* name, size_t size, size_t align, void (*ctor)(void*)) {
+    if (size == 0 || (align & (align - 1)) != 0) {
+        return nullptr; // Alignment must be a power of two (0 means default)
+    }
+    if (align < HEAP_ALIGN) {
+        align = HEAP_ALIGN;
+    }
+    kmem_cache* cache = (kmem_cache*)kmalloc(sizeof(kmem_cache));
+    if (!cache) {
+        return nullptr;
+    }
+    if (!cache_setup(cache, name, size, align, ctor)) {
+        kfree(cache);
+        return nullptr; // Object too large for a single-page slab
+    }
+    cache->next = user_caches;
+    user_caches = cache;
+    return cache;
+}
+
+void* kmem_cache_alloc(kmem_cache* cache) {
+    if (!cache) {
+        return nullptr;
+    }
+    void* obj = slab_alloc(cache);
+    if (!obj) {
+        stats.failed_count++;
+        return nullptr;
+    }
+    account_alloc(__builtin_return_address(0), cache->object_size, cache->stride);
+    return obj;
+}
+
+void kmem_cache_free(kmem_cache* cache, void* obj) {
+    if (!cache || !obj) {
+        return;
+    }
+    slab* s = (slab*)((uintptr_t)obj & ~(uintptr_t)(PAGE_SIZE - 1));
+    if (s->magic == SLAB_MAGIC && s->cache == cache) {
+        account_free(cache->stride);
+        slab_free(s, obj);
+    }
+}
+
+// --- Default Memory Resource ---
+
+void* mem_resource::allocate(size_t bytes, size_t align) {
+    return heap_alloc_aligned(bytes, align, __builtin_return_address(0));
+}
+
+void mem_resource::deallocate(void* ptr, size_t, size_t align) {
+    kfree_aligned(ptr, align);
+}
+
+bool mem_resource::try_expand(void* ptr, size_t new_bytes, size_t align) {
+    return kexpand_aligned(ptr, new_bytes, align);
+}
+
+// Constant-initialised (constexpr constructor), so it is usable before any
+// global constructors would have run - and boot.asm runs none.
+static mem_resource kernel_heap_resource;
+
+mem_resource* heap_resource() {
+    return &kernel_heap_resource;
+}
+
+// --- Statistics Queries ---
+
+// Size classes first, then the chain of user caches. nullptr past the end.
+static kmem_cache* cache_at(int index) {
+    if (index < 0) {
+        return nullptr;
+    }
+    if (index < SIZE_CLASS_COUNT) {
+        return &caches[index];
+    }
+    kmem_cache* cache = user_caches;
+    for (int i = SIZE_CLASS_COUNT; cache && i < index; ++i) {
+        cache = cache->next;
+    }
+    return cache;
+}
+
+void heap_get_stats(heap_stats* out) {
+    *out = stats;
+    out->slab_pages = 0;
+    out->slab_free_bytes = 0;
+    for (int i = 0; kmem_cache* cache = cache_at(i); ++i) {
+        out->slab_pages += cache->slabs;
+        out->slab_free_bytes += ((size_t)cache->slabs * cache->capacity - cache->active) * cache->stride;
+    }
+}
+
+bool heap_get_cache_stats(int index, heap_cache_stats* out) {
+    const kmem_cache* cache = cache_at(index);
+    if (!cache) {
+        return false;
+    }
+    out->name = cache->name;
+    out->object_size = cache->object_size;
+    out->active = cache->active;
+    out->allocs = cache->allocs;
+    out->frees = cache->frees;
+    out->slabs = cache->slabs;
+    return true;
+}
+
+int heap_get_top_sites(heap_site_stats* out, int max) {
+    // Selection of the 'max' largest entries by bytes; the table is tiny.
+    bool taken[SITE_TABLE_SIZE] = {};
+    int count = 0;
+    while (count < max) {
+        int best = -1;
+        for (int i = 0; i < SITE_TABLE_SIZE; ++i) {
+            if (site_table[i].site && !taken[i] && (best < 0 || site_table[i].bytes > site_table[best].bytes)) {
+                best = i;
+            }
+        }
+        if (best < 0) {
+            break;
+        }
+        taken[best] = true;
+        out[count++] = site_table[best];
+    }
+    return count;
+}
+
+uint32_t heap_dropped_sites() {
+    return sites_dropped;
+}
+
+// --- Operators ---
+
+// The operators call heap_alloc() directly so the recorded call site is the
+// code doing the 'new', not the operator itself.
+
+void* operator new[](size_t size) noexcept {
+    return heap_alloc(size, __builtin_return_address(0));
+}
+
+void operator delete[](void* ptr) noexcept {
+    kfree(ptr);
+}
+
+void* operator new(size_t size) noexcept {
+    return heap_alloc(size, __builtin_return_address(0));
+}
+
 void operator delete(void* ptr) noexcept {
-    (void)ptr;
+    kfree(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept {
+    kfree(ptr);
+}
+
+void operator delete[](void* ptr, size_t) noexcept {
+    kfree(ptr);
+}
+
+void* operator new(size_t size, std::align_val_t align) noexcept {
+    return heap_alloc_aligned(size, (size_t)align, __builtin_return_address(0));
+}
+
+void* operator new[](size_t size, std::align_val_t align) noexcept {
+    return heap_alloc_aligned(size, (size_t)align, __builtin_return_address(0));
+}
+
+void operator delete(void* ptr, std::align_val_t align) noexcept {
+    kfree_aligned(ptr, (size_t)align);
+}
+
+void operator delete[](void* ptr, std::align_val_t align) noexcept {
+    kfree_aligned(ptr, (size_t)align);
+}
+
+void operator delete(void* ptr, size_t, std::align_val_t align) noexcept {
+    kfree_aligned(ptr, (size_t)align);
+}
+
+void operator delete[](void* ptr, size_t, std::align_val_t align) noexcept {
+    kfree_aligned(ptr, (size_t)align);
 }
-*/
 
 
 // --- Function Definitions ---
-uint32_t get_total_ram_mb(multiboot_info* mbi) {
+INIT_CODE uint32_t get_total_ram_mb(multiboot_info* mbi) {
     if (!mbi) return 0; // Safety check
 
     // Check if basic memory info is available (bit 0 of flags)
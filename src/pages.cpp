@@ -0,0 +1,509 @@
+#include "include/pages.h"
+#include "include/inits.h" // For INIT_CODE/INIT_DATA and the init block bounds
+#include "include/logs.h"  // For klog() when the reserved range table overflows
+
+// --- Frame Metadata ---
+// One byte per frame, from min_pfn up to max_pfn. Only block heads carry an
+// order; every other frame of a block is marked FRAME_TAIL. Coalescing only
+// ever inspects the head of the buddy block, so tails never need updating.
+#define FRAME_RESERVED   0xFF // Not managed (hole, firmware, kernel, metadata)
+#define FRAME_TAIL       0xFE // Part of a larger block, not its head
+#define FRAME_FREE_HEAD  0x80 // Head of a free block, low bits hold the order
+#define FRAME_USED_HEAD  0x40 // Head of an allocated block, low bits hold the order
+#define FRAME_ORDER_MASK 0x1F
+
+// Memory below 1 MiB holds the BDA, EBDA (scanned by find_rsdp), VGA memory and
+// the BIOS ROM. It is never handed out, even where the map says it is type 1.
+#define LOW_MEMORY_LIMIT 0x100000ULL
+// Paging is off and pointers are 32 bits wide, so nothing above 4 GiB is usable.
+#define ADDRESS_LIMIT    0x100000000ULL
+
+// Free blocks are linked through their own first bytes.
+struct free_block {
+    free_block* next;
+    free_block* prev;
+};
+
+static uint8_t* frame_info = nullptr;
+static size_t min_pfn = 0; // First frame covered by frame_info
+static size_t max_pfn = 0; // One past the last frame covered by frame_info
+static free_block* free_lists[PAGE_MAX_ORDER + 1];
+static size_t total_frames = 0;
+static size_t free_frames = 0;
+
+// Pre-zeroed single pages. Kept in an array rather than linked through the
+// pages themselves, so the pages stay entirely zero. Pooled pages count as
+// allocated.
+static void* zeroed_pages[ZERO_POOL_PAGES];
+static size_t zeroed_count = 0;
+
+// --- Reserved Ranges ---
+// Filled in by pages_init() before the free lists are built; boot-only.
+struct phys_range {
+    uint64_t start;
+    uint64_t end; // Exclusive
+};
+
+#define MAX_RESERVED_RANGES 16
+static phys_range reserved_ranges[MAX_RESERVED_RANGES] INIT_DATA;
+static int reserved_count INIT_DATA = 0;
+
+INIT_CODE static void reserve_range(uint64_t start, uint64_t end) {
+    if (end <= start) {
+        return;
+    }
+    // Widen to page boundaries so a partially used frame is never handed out.
+    start &= ~(uint64_t)(PAGE_SIZE - 1);
+    end = (end + PAGE_SIZE - 1) & ~(uint64_t)(PAGE_SIZE - 1);
+
+    if (reserved_count < MAX_RESERVED_RANGES) {
+        reserved_ranges[reserved_count].start = start;
+        reserved_ranges[reserved_count].end = end;
+        reserved_count++;
+        return;
+    }
+
+    // The table is full (many boot modules). Dropping the range would let its
+    // frames be handed out while still in use, so grow the closest entry to
+    // cover it instead. Whatever lies in between is reserved as well: a few
+    // frames lost, never one overwritten.
+    int closest = 0;
+    uint64_t closest_gap = ~(uint64_t)0;
+    for (int i = 0; i < reserved_count; ++i) {
+        const phys_range& r = reserved_ranges[i];
+        uint64_t gap = start >= r.end ? start - r.end : r.start >= end ? r.start - end : 0;
+        if (gap < closest_gap) {
+            closest = i;
+            closest_gap = gap;
+        }
+    }
+    phys_range& r = reserved_ranges[closest];
+    if (start < r.start) {
+        r.start = start;
+    }
+    if (end > r.end) {
+        r.end = end;
+    }
+    klog(KLOG_WARN, "pages", "reserved range table full: merged %#llx-%#llx into %#llx-%#llx (%llu KiB extra)",
+         start, end, r.start, r.end, closest_gap >> 10);
+}
+
+// --- Free List Helpers ---
+
+static inline uint8_t& frame_at(size_t pfn) {
+    return frame_info[pfn - min_pfn];
+}
+
+static inline free_block* pfn_to_block(size_t pfn) {
+    return (free_block*)(pfn << PAGE_SHIFT);
+}
+
+static inline size_t addr_to_pfn(const void* addr) {
+    return (uintptr_t)addr >> PAGE_SHIFT;
+}
+
+static void list_push(unsigned int order, size_t pfn) {
+    free_block* block = pfn_to_block(pfn);
+    block->prev = nullptr;
+    block->next = free_lists[order];
+    if (free_lists[order]) {
+        free_lists[order]->prev = block;
+    }
+    free_lists[order] = block;
+    frame_at(pfn) = FRAME_FREE_HEAD | order;
+}
+
+static void list_remove(unsigned int order, free_block* block) {
+    if (block->prev) {
+        block->prev->next = block->next;
+    } else {
+        free_lists[order] = block->next;
+    }
+    if (block->next) {
+        block->next->prev = block->prev;
+    }
+}
+
+// Puts a block on the free lists, merging it with its buddy while possible.
+static void free_block_at(size_t pfn, unsigned int order) {
+    while (order < PAGE_MAX_ORDER) {
+        size_t buddy = pfn ^ ((size_t)1 << order);
+        if (buddy < min_pfn || buddy >= max_pfn || frame_at(buddy) != (FRAME_FREE_HEAD | order)) {
+            break;
+        }
+        list_remove(order, pfn_to_block(buddy));
+        frame_at(buddy) = FRAME_TAIL;
+        frame_at(pfn) = FRAME_TAIL;
+        if (buddy < pfn) {
+            pfn = buddy;
+        }
+        order++;
+    }
+    list_push(order, pfn);
+}
+
+// Hands the page-aligned range [start, end) to the allocator as the largest
+// naturally aligned blocks that fit.
+static void add_free_range(uint64_t start, uint64_t end) {
+    size_t pfn = (size_t)(start >> PAGE_SHIFT);
+    size_t end_pfn = (size_t)(end >> PAGE_SHIFT);
+
+    while (pfn < end_pfn) {
+        unsigned int order = PAGE_MAX_ORDER;
+        while (order > 0 && ((pfn & (((size_t)1 << order) - 1)) != 0 || pfn + ((size_t)1 << order) > end_pfn)) {
+            order--;
+        }
+        size_t count = (size_t)1 << order;
+        for (size_t i = 0; i < count; ++i) {
+            frame_at(pfn + i) = FRAME_TAIL;
+        }
+        total_frames += count;
+        free_frames += count;
+        free_block_at(pfn, order);
+        pfn += count;
+    }
+}
+
+// Calls add_free_range() for the parts of [start, end) not covered by a reserved range.
+INIT_CODE static void add_unreserved_range(uint64_t start, uint64_t end) {
+    for (int i = 0; i < reserved_count; ++i) {
+        const phys_range& r = reserved_ranges[i];
+        if (r.start < end && r.end > start) {
+            if (r.start > start) {
+                add_unreserved_range(start, r.start);
+            }
+            if (r.end < end) {
+                add_unreserved_range(r.end, end);
+            }
+            return;
+        }
+    }
+    add_free_range(start, end);
+}
+
+// Clips an mmap entry to the usable, page-aligned window. Returns false if nothing is left.
+INIT_CODE static bool clip_region(const mmap_entry* entry, uint64_t& start, uint64_t& end) {
+    start = entry->addr;
+    end = entry->addr + entry->len;
+    if (start < LOW_MEMORY_LIMIT) start = LOW_MEMORY_LIMIT;
+    if (end > ADDRESS_LIMIT) end = ADDRESS_LIMIT;
+    start = (start + PAGE_SIZE - 1) & ~(uint64_t)(PAGE_SIZE - 1);
+    end &= ~(uint64_t)(PAGE_SIZE - 1);
+    return end > start;
+}
+
+static inline mmap_entry* next_mmap_entry(mmap_entry* entry) {
+    // Same iteration rule as get_total_ram_mb(): 'size' does not include itself.
+    return (mmap_entry*)((uintptr_t)entry + entry->size + sizeof(uint32_t));
+}
+
+// Fallback when there is no usable memory map: manage the static pool only.
+INIT_CODE static void init_from_static_pool() {
+    static uint8_t pool_frame_info[sizeof(memory_pool) / PAGE_SIZE];
+    uint64_t start = ((uintptr_t)memory_pool + PAGE_SIZE - 1) & ~(uintptr_t)(PAGE_SIZE - 1);
+    uint64_t end = ((uintptr_t)memory_pool + sizeof(memory_pool)) & ~(uintptr_t)(PAGE_SIZE - 1);
+
+    min_pfn = (size_t)(start >> PAGE_SHIFT);
+    max_pfn = (size_t)(end >> PAGE_SHIFT);
+    frame_info = pool_frame_info;
+    memset(pool_frame_info, FRAME_RESERVED, sizeof(pool_frame_info));
+    add_free_range(start, end);
+}
+
+// --- Public API ---
+
+INIT_CODE void pages_init(multiboot_info* mbi) {
+    for (unsigned int i = 0; i <= PAGE_MAX_ORDER; ++i) {
+        free_lists[i] = nullptr;
+    }
+    frame_info = nullptr;
+    min_pfn = 0;
+    max_pfn = 0;
+    total_frames = 0;
+    free_frames = 0;
+    reserved_count = 0;
+    zeroed_count = 0;
+
+    // Without a memory map the heap still needs pages: fall back to memory_pool.
+    if (!mbi || !(mbi->flags & (1 << 6)) || mbi->mmap_addr == 0 || mbi->mmap_length == 0) {
+        init_from_static_pool();
+        return;
+    }
+
+    // Everything the kernel or the bootloader still needs must stay out of the free lists.
+    reserve_range((uintptr_t)kernel_start, (uintptr_t)kernel_end);
+    reserve_range((uintptr_t)mbi, (uintptr_t)mbi + sizeof(multiboot_info));
+    reserve_range(mbi->mmap_addr, (uint64_t)mbi->mmap_addr + mbi->mmap_length);
+    if ((mbi->flags & (1 << 2)) && mbi->cmdline != 0) { // Bit 2: cmdline
+        const char* cmdline = (const char*)((uintptr_t)mbi->cmdline);
+        size_t len = 0;
+        while (cmdline[len] != '\0') {
+            len++;
+        }
+        reserve_range(mbi->cmdline, (uint64_t)mbi->cmdline + len + 1);
+    }
+    if ((mbi->flags & (1 << 3)) && mbi->mods_count > 0) { // Bit 3: boot modules
+        multiboot_module* mods = (multiboot_module*)((uintptr_t)mbi->mods_addr);
+        reserve_range(mbi->mods_addr, (uint64_t)mbi->mods_addr + mbi->mods_count * sizeof(multiboot_module));
+        for (uint32_t i = 0; i < mbi->mods_count; ++i) {
+            reserve_range(mods[i].mod_start, mods[i].mod_end);
+        }
+    }
+
+    // Pass 1: find the highest usable frame to size the metadata array.
+    uint64_t highest = 0;
+    uint32_t offset = 0;
+    mmap_entry* entry = (mmap_entry*)((uintptr_t)mbi->mmap_addr);
+    while (offset < mbi->mmap_length && entry->size != 0) {
+        uint64_t start, end;
+        if (entry->type == 1 && clip_region(entry, start, end) && end > highest) {
+            highest = end;
+        }
+        offset += entry->size + sizeof(uint32_t);
+        entry = next_mmap_entry(entry);
+    }
+    if (highest == 0) {
+        init_from_static_pool();
+        return;
+    }
+    max_pfn = (size_t)(highest >> PAGE_SHIFT);
+
+    // Pass 2: carve the metadata array out of the first free stretch big enough to hold it.
+    uint64_t info_bytes = ((uint64_t)max_pfn + PAGE_SIZE - 1) & ~(uint64_t)(PAGE_SIZE - 1);
+    offset = 0;
+    entry = (mmap_entry*)((uintptr_t)mbi->mmap_addr);
+    while (frame_info == nullptr && offset < mbi->mmap_length && entry->size != 0) {
+        uint64_t start, end;
+        if (entry->type == 1 && clip_region(entry, start, end)) {
+            // Step over any reserved range that overlaps the candidate spot.
+            uint64_t candidate = start;
+            bool moved = true;
+            while (moved && candidate + info_bytes <= end) {
+                moved = false;
+                for (int i = 0; i < reserved_count; ++i) {
+                    const phys_range& r = reserved_ranges[i];
+                    if (r.start < candidate + info_bytes && r.end > candidate) {
+                        candidate = r.end;
+                        moved = true;
+                    }
+                }
+            }
+            if (candidate + info_bytes <= end) {
+                frame_info = (uint8_t*)((uintptr_t)candidate);
+                reserve_range(candidate, candidate + info_bytes);
+            }
+        }
+        offset += entry->size + sizeof(uint32_t);
+        entry = next_mmap_entry(entry);
+    }
+    if (frame_info == nullptr) {
+        init_from_static_pool();
+        return;
+    }
+    memset(frame_info, FRAME_RESERVED, max_pfn);
+
+    // Pass 3: hand every available, unreserved frame to the buddy allocator.
+    offset = 0;
+    entry = (mmap_entry*)((uintptr_t)mbi->mmap_addr);
+    while (offset < mbi->mmap_length && entry->size != 0) {
+        uint64_t start, end;
+        if (entry->type == 1 && clip_region(entry, start, end)) {
+            add_unreserved_range(start, end);
+        }
+        offset += entry->size + sizeof(uint32_t);
+        entry = next_mmap_entry(entry);
+    }
+}
+
+static void zero_pool_flush();
+
+void* pages_alloc(unsigned int order) {
+    if (order > PAGE_MAX_ORDER) {
+        return nullptr;
+    }
+
+    unsigned int k = order;
+    while (k <= PAGE_MAX_ORDER && free_lists[k] == nullptr) {
+        k++;
+    }
+    if (k > PAGE_MAX_ORDER) {
+        // The pre-zeroed pool is free memory as well, just cleared already:
+        // use it before failing.
+        if (zeroed_count == 0) {
+            return nullptr; // Out of physical memory (or too fragmented)
+        }
+        if (order == 0) {
+            return zeroed_pages[--zeroed_count];
+        }
+        zero_pool_flush(); // Let its pages coalesce into larger blocks
+        return pages_alloc(order);
+    }
+
+    free_block* block = free_lists[k];
+    list_remove(k, block);
+    size_t pfn = addr_to_pfn(block);
+
+    // Split off upper halves until the block has the requested size.
+    while (k > order) {
+        k--;
+        list_push(k, pfn + ((size_t)1 << k));
+    }
+
+    frame_at(pfn) = FRAME_USED_HEAD | order;
+    free_frames -= (size_t)1 << order;
+    return block;
+}
+
+void pages_free(void* addr) {
+    if (!addr || ((uintptr_t)addr & (PAGE_SIZE - 1)) != 0) {
+        return;
+    }
+    size_t pfn = addr_to_pfn(addr);
+    if (pfn < min_pfn || pfn >= max_pfn) {
+        return;
+    }
+    uint8_t info = frame_at(pfn);
+    if ((info & ~FRAME_ORDER_MASK) != FRAME_USED_HEAD) {
+        return; // Not the head of an allocated block (double free or foreign pointer)
+    }
+    unsigned int order = info & FRAME_ORDER_MASK;
+    free_frames += (size_t)1 << order;
+    free_block_at(pfn, order);
+}
+
+bool pages_expand(void* addr, unsigned int new_order) {
+    int order = pages_order_of(addr);
+    if (order < 0 || new_order > PAGE_MAX_ORDER) {
+        return false;
+    }
+    size_t pfn = addr_to_pfn(addr);
+
+    // Check every step first, so a failure leaves the lists untouched. Each
+    // step doubles the block, which works only while it is the lower half of
+    // its parent and the upper half is one whole free block.
+    for (unsigned int k = order; k < new_order; ++k) {
+        size_t buddy = pfn + ((size_t)1 << k);
+        if ((pfn & (((size_t)1 << (k + 1)) - 1)) != 0 || buddy >= max_pfn || frame_at(buddy) != (FRAME_FREE_HEAD | k)) {
+            return false;
+        }
+    }
+
+    for (unsigned int k = order; k < new_order; ++k) {
+        size_t buddy = pfn + ((size_t)1 << k);
+        list_remove(k, pfn_to_block(buddy));
+        frame_at(buddy) = FRAME_TAIL;
+        free_frames -= (size_t)1 << k;
+    }
+    if ((unsigned int)order < new_order) {
+        frame_at(pfn) = FRAME_USED_HEAD | new_order;
+    }
+    return true;
+}
+
+// --- Pre-Zeroed Pages ---
+
+void* pages_alloc_zeroed(unsigned int order) {
+    if (order == 0 && zeroed_count > 0) {
+        return zeroed_pages[--zeroed_count];
+    }
+    void* block = pages_alloc(order);
+    if (block) {
+        memset(block, 0, (size_t)PAGE_SIZE << order);
+    }
+    return block;
+}
+
+bool pages_zero_idle() {
+    bool cleared = false;
+    for (int i = 0; i < ZERO_IDLE_BATCH && zeroed_count < ZERO_POOL_PAGES; ++i) {
+        // Leave the last free pages to real allocations.
+        if (free_frames <= ZERO_POOL_PAGES) {
+            break;
+        }
+        void* page = pages_alloc(0);
+        if (!page) {
+            break;
+        }
+        memset(page, 0, PAGE_SIZE);
+        zeroed_pages[zeroed_count++] = page;
+        cleared = true;
+    }
+    return cleared;
+}
+
+// Returns every pooled page to the free lists.
+static void zero_pool_flush() {
+    while (zeroed_count > 0) {
+        pages_free(zeroed_pages[--zeroed_count]);
+    }
+}
+
+size_t pages_zeroed_count() {
+    return zeroed_count;
+}
+
+unsigned int pages_order_for(size_t bytes) {
+    unsigned int order = 0;
+    size_t block = PAGE_SIZE;
+    while (block < bytes && order <= PAGE_MAX_ORDER) {
+        block <<= 1;
+        order++;
+    }
+    return order;
+}
+
+size_t pages_total_count() {
+    return total_frames;
+}
+
+size_t pages_free_count() {
+    return free_frames;
+}
+
+int pages_largest_free_order() {
+    for (int order = PAGE_MAX_ORDER; order >= 0; --order) {
+        if (free_lists[order]) {
+            return order;
+        }
+    }
+    return -1;
+}
+
+// --- Init Memory ---
+
+size_t free_init_memory() {
+    size_t start_pfn = ((uintptr_t)init_start + PAGE_SIZE - 1) >> PAGE_SHIFT;
+    size_t end_pfn = (uintptr_t)init_end >> PAGE_SHIFT;
+    size_t released = 0;
+
+    // Only frames the allocator tracks as reserved can be handed over (with
+    // the static-pool fallback, the kernel image is not tracked at all).
+    // add_free_range() splits each run into naturally aligned blocks.
+    size_t pfn = start_pfn;
+    while (pfn < end_pfn) {
+        if (pfn < min_pfn || pfn >= max_pfn || frame_at(pfn) != FRAME_RESERVED) {
+            pfn++;
+            continue;
+        }
+        size_t run_end = pfn;
+        while (run_end < end_pfn && run_end < max_pfn && frame_at(run_end) == FRAME_RESERVED) {
+            run_end++;
+        }
+        add_free_range((uint64_t)pfn << PAGE_SHIFT, (uint64_t)run_end << PAGE_SHIFT);
+        released += run_end - pfn;
+        pfn = run_end;
+    }
+    return released * PAGE_SIZE;
+}
+
+int pages_order_of(void* addr) {
+    size_t pfn = addr_to_pfn(addr);
+    if (((uintptr_t)addr & (PAGE_SIZE - 1)) != 0 || pfn < min_pfn || pfn >= max_pfn) {
+        return -1;
+    }
+    uint8_t info = frame_at(pfn);
+    if ((info & ~FRAME_ORDER_MASK) != FRAME_USED_HEAD) {
+        return -1;
+    }
+    return info & FRAME_ORDER_MASK;
+}
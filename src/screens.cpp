@@ -1,41 +1,246 @@
 #include "include/screens.h"
-#include "include/consts.h" // For VGA_WIDTH, VGA_HEIGHT, VGA_DEFAULT_COLOR
+#include "include/consts.h"   // For VGA_WIDTH, VGA_HEIGHT, VGA_DEFAULT_COLOR
+#include "include/memorys.h"  // For memmove
+#include "include/io.h"       // For outb (CRTC registers)
 
 // --- Screen Global Variable Definitions ---
 volatile uint16_t* vga_buffer = (volatile uint16_t*)0xB8000;
 uint16_t cursor_x = 0;
 uint16_t cursor_y = 0;
 
+// --- Shadow Screen ---
+// All output goes to this ordinary (cacheable) copy of the screen. VRAM is
+// uncached and, under emulation, every access to it can trap, so it is only
+// written by screen_flush(), one whole changed line at a time.
+static uint16_t shadow[SCREEN_ROWS * SCREEN_COLS];
+static uint32_t dirty_lines = 0; // Bit y set: line y of the shadow differs from VRAM
+
+static_assert(SCREEN_ROWS <= 32, "dirty_lines has one bit per line");
+
+// --- Hardware Scrolling ---
+// The text aperture at 0xB8000 is 32 KiB, room for VRAM_LINES lines, while
+// the screen shows SCREEN_ROWS of them starting at the CRTC start address.
+// Scrolling just moves that start one line further down the aperture: lines
+// already in VRAM stay where they are, and only the new bottom line has to
+// be written. When the window reaches the end of the aperture it jumps back
+// to the top, and only then is the whole screen copied.
+#define VRAM_LINES    (32768 / (SCREEN_COLS * 2))
+#define CRTC_INDEX    0x3D4
+#define CRTC_DATA     0x3D5
+#define CRTC_START_HI 0x0C
+#define CRTC_START_LO 0x0D
+#define CRTC_CURSOR_START 0x0A // Bit 5 hides the cursor; bits 0-4 are its top scanline
+#define CRTC_CURSOR_END   0x0B
+#define CRTC_CURSOR_HI    0x0E
+#define CRTC_CURSOR_LO    0x0F
+
+static uint32_t vram_top = 0;       // Aperture line shown as screen row 0
+static uint32_t pending_scroll = 0; // Lines scrolled in the shadow since the last flush
+
+// --- Hardware Cursor ---
+// The blinking VGA cursor, positioned in cells from the start of the aperture
+// (so it includes the scroll offset). The registers are only written by the
+// flush, and only when the position actually changed.
+static uint32_t cursor_cell = 0xFFFFFFFF; // Position last written, none yet
+
+static void set_cursor_cell(uint32_t cell) {
+    if (cell == cursor_cell) {
+        return;
+    }
+    cursor_cell = cell;
+    outb(CRTC_INDEX, CRTC_CURSOR_HI);
+    outb(CRTC_DATA, (uint8_t)(cell >> 8));
+    outb(CRTC_INDEX, CRTC_CURSOR_LO);
+    outb(CRTC_DATA, (uint8_t)cell);
+}
+
+// Underline cursor on scanlines 14-15, made visible in case the boot loader
+// disabled it.
+static void enable_cursor() {
+    outb(CRTC_INDEX, CRTC_CURSOR_START);
+    outb(CRTC_DATA, (inb(CRTC_DATA) & 0xC0) | 14);
+    outb(CRTC_INDEX, CRTC_CURSOR_END);
+    outb(CRTC_DATA, (inb(CRTC_DATA) & 0xE0) | 15);
+}
+
+static void set_start_address(uint32_t cell) {
+    outb(CRTC_INDEX, CRTC_START_HI);
+    outb(CRTC_DATA, (uint8_t)(cell >> 8));
+    outb(CRTC_INDEX, CRTC_START_LO);
+    outb(CRTC_DATA, (uint8_t)cell);
+}
+
+// --- Scrollback ---
+// Lines that scroll off the top are kept in a ring of SCROLLBACK_LINES lines
+// (the oldest is overwritten). screen_view_scroll() moves a viewport back
+// through them; the flush then draws the viewport from the ring and the
+// shadow instead of the live screen. Output keeps going to the shadow in the
+// meantime, and screen_view_live() returns to it.
+static uint16_t history[SCROLLBACK_LINES][SCREEN_COLS];
+static uint32_t history_next = 0;  // Ring slot the next line goes to
+static uint32_t history_count = 0; // Lines stored, up to SCROLLBACK_LINES
+static uint32_t view_offset = 0;   // Lines scrolled back, 0 = live screen
+static bool view_changed = false;  // The viewport must be redrawn
+
+static inline uint16_t blank_cell() {
+    return (uint16_t)((VGA_DEFAULT_COLOR << 8) | ' ');
+}
+
 // --- Screen Function Definitions ---
 
-void cls() {
-    for (uint16_t y = 0; y < VGA_HEIGHT; ++y) {
-        for (uint16_t x = 0; x < VGA_WIDTH; ++x) {
-            // Use VGA_DEFAULT_COLOR from consts.h for the background/foreground
-            vga_buffer[y * VGA_WIDTH + x] = (VGA_DEFAULT_COLOR << 8) | ' ';
+void screen_put(uint16_t x, uint16_t y, uint16_t cell) {
+    if (x >= SCREEN_COLS || y >= SCREEN_ROWS) {
+        return;
+    }
+    shadow[y * SCREEN_COLS + x] = cell;
+    dirty_lines |= 1u << y;
+}
+
+void screen_write(uint16_t x, uint16_t y, const char* text, uint32_t n, int color) {
+    if (x >= SCREEN_COLS || y >= SCREEN_ROWS) {
+        return;
+    }
+    if (n > (uint32_t)(SCREEN_COLS - x)) {
+        n = SCREEN_COLS - x;
+    }
+    uint16_t attr = (uint16_t)(color << 8);
+    uint16_t* dst = &shadow[y * SCREEN_COLS + x];
+    for (uint32_t i = 0; i < n; ++i) {
+        dst[i] = attr | (uint8_t)text[i];
+    }
+    dirty_lines |= 1u << y;
+}
+
+uint16_t screen_get(uint16_t x, uint16_t y) {
+    if (x >= SCREEN_COLS || y >= SCREEN_ROWS) {
+        return blank_cell();
+    }
+    return shadow[y * SCREEN_COLS + x];
+}
+
+// Row 'y' of the viewport: older lines come from the ring, the rest from the
+// top of the shadow.
+static const uint16_t* view_line(uint32_t y) {
+    if (y < view_offset) {
+        uint32_t back = view_offset - y; // 1 = most recent history line
+        return history[(history_next + SCROLLBACK_LINES - back) % SCROLLBACK_LINES];
+    }
+    return &shadow[(y - view_offset) * SCREEN_COLS];
+}
+
+static void draw_view() {
+    for (uint32_t y = 0; y < SCREEN_ROWS; ++y) {
+        const uint32_t* src = (const uint32_t*)view_line(y);
+        volatile uint32_t* dst = (volatile uint32_t*)&vga_buffer[(vram_top + y) * SCREEN_COLS];
+        for (uint32_t i = 0; i < SCREEN_COLS / 2; ++i) {
+            dst[i] = src[i];
         }
     }
-    cursor_x = 0;
-    cursor_y = 0;
 }
 
-void scroll_screen(volatile uint16_t* buffer_to_scroll) {
-    // If you chose the void scroll_screen() version in the header,
-    // remove the parameter and use the global vga_buffer directly here:
-    // volatile uint16_t* buffer_to_scroll = vga_buffer;
+void screen_view_scroll(int lines) {
+    int32_t offset = (int32_t)view_offset + lines;
+    if (offset < 0) {
+        offset = 0;
+    }
+    if ((uint32_t)offset > history_count) {
+        offset = history_count;
+    }
+    if ((uint32_t)offset == view_offset) {
+        return;
+    }
+    if (offset == 0) {
+        screen_view_live();
+        return;
+    }
+    view_offset = offset;
+    view_changed = true;
+}
+
+void screen_view_live() {
+    if (view_offset) {
+        view_offset = 0;
+        dirty_lines = (1u << SCREEN_ROWS) - 1; // VRAM holds the viewport
+    }
+}
+
+void screen_flush() {
+    if (pending_scroll) {
+        uint32_t top = vram_top + pending_scroll;
+        if (top + SCREEN_ROWS > VRAM_LINES) {
+            top = 0; // Wrapped: redraw everything at the start of the aperture
+            dirty_lines = (1u << SCREEN_ROWS) - 1;
+        }
+        vram_top = top;
+        pending_scroll = 0;
+        set_start_address(vram_top * SCREEN_COLS);
+    }
+
+    if (view_offset) {
+        if (view_changed) {
+            draw_view();
+            view_changed = false;
+        }
+        // The input position is not on screen: park the cursor on the line
+        // just below the window, where it cannot be seen.
+        set_cursor_cell((vram_top + SCREEN_ROWS) * SCREEN_COLS);
+        return; // dirty_lines wait until the live screen is shown again
+    }
+
+    uint32_t pending = dirty_lines;
+    dirty_lines = 0;
+    while (pending) {
+        uint32_t y = __builtin_ctz(pending);
+        pending &= pending - 1;
 
-    for (uint16_t y = 0; y < VGA_HEIGHT - 1; ++y) {
-        for (uint16_t x = 0; x < VGA_WIDTH; ++x) {
-            buffer_to_scroll[y * VGA_WIDTH + x] = buffer_to_scroll[(y + 1) * VGA_WIDTH + x];
+        // Two cells per 32-bit store: half the bus writes of 16-bit stores.
+        const uint32_t* src = (const uint32_t*)&shadow[y * SCREEN_COLS];
+        volatile uint32_t* dst = (volatile uint32_t*)&vga_buffer[(vram_top + y) * SCREEN_COLS];
+        for (uint32_t i = 0; i < SCREEN_COLS / 2; ++i) {
+            dst[i] = src[i];
         }
     }
+
+    set_cursor_cell((vram_top + cursor_y) * SCREEN_COLS + cursor_x);
+}
+
+void cls() {
+    static bool cursor_enabled = false;
+    if (!cursor_enabled) {
+        enable_cursor(); // cls() runs first thing at boot
+        cursor_enabled = true;
+    }
+
+    uint16_t blank = blank_cell();
+    for (uint16_t i = 0; i < SCREEN_ROWS * SCREEN_COLS; ++i) {
+        shadow[i] = blank;
+    }
+    dirty_lines = (1u << SCREEN_ROWS) - 1;
+    cursor_x = 0;
+    cursor_y = 0;
+    screen_view_live();
+}
+
+void scroll_screen() {
+    // Keep the line that is about to disappear (O(1): one line copy).
+    memcpy(history[history_next], shadow, sizeof(history[0]));
+    history_next = (history_next + 1) % SCROLLBACK_LINES;
+    if (history_count < SCROLLBACK_LINES) {
+        history_count++;
+    }
+
+    // One memmove in cached memory instead of reading back every VRAM cell.
+    memmove(shadow, shadow + SCREEN_COLS, (SCREEN_ROWS - 1) * SCREEN_COLS * sizeof(uint16_t));
+
     // Clear the last line
-    for (uint16_t x = 0; x < VGA_WIDTH; ++x) {
-        // Use VGA_DEFAULT_COLOR for the new empty line's attributes
-        buffer_to_scroll[(VGA_HEIGHT - 1) * VGA_WIDTH + x] = (VGA_DEFAULT_COLOR << 8) | ' ';
+    uint16_t blank = blank_cell();
+    for (uint16_t x = 0; x < SCREEN_COLS; ++x) {
+        shadow[(SCREEN_ROWS - 1) * SCREEN_COLS + x] = blank;
     }
+    // The shadow's lines moved up by one, and so will VRAM's once the flush
+    // moves the start address: only the new bottom line has to be written.
+    dirty_lines = (dirty_lines >> 1) | (1u << (SCREEN_ROWS - 1));
+    pending_scroll++;
     // Note: The cursor_y is typically adjusted by the print_char function
     // when it detects it has gone past VGA_HEIGHT - 1 *after* scrolling.
-    // So, scroll_screen itself might not need to touch cursor_y directly,
-    // but print_char will set it to VGA_HEIGHT - 1.
-}
\ No newline at end of file
+}
@@ -0,0 +1,110 @@
+#include "include/serials.h"
+#include "include/rings.h"      // For the TX ring
+#include "include/interrupts.h" // For IRQ 4 and interrupts_save_disable()
+#include "include/io.h"         // For outb/inb and console_add_sink()
+#include "include/inits.h"      // For INIT_CODE
+#include "include/logs.h"       // For klog()
+
+// --- 16550 Registers (offsets from the port base) ---
+#define UART_DATA 0 // THR on write; divisor low byte while DLAB is set
+#define UART_IER  1 // Interrupt enable; divisor high byte while DLAB is set
+#define UART_FCR  2 // FIFO control (write)
+#define UART_IIR  2 // Interrupt identification (read)
+#define UART_LCR  3
+#define UART_MCR  4
+#define UART_LSR  5
+
+#define IER_THR_EMPTY 0x02 // Interrupt when the transmit FIFO has drained
+#define FCR_ENABLE    0xC7 // Enable and clear both FIFOs, 14-byte RX trigger
+#define LCR_DLAB      0x80
+#define LCR_8N1       0x03
+#define MCR_DTR_RTS_OUT2 0x0B // OUT2 connects the UART's interrupt to the PIC
+#define LSR_THR_EMPTY 0x20
+
+#define UART_FIFO_SIZE 16
+#define UART_DIVISOR   1 // 115200 / 1
+
+static ring_buffer<char, SERIAL_TX_BUFFER_SIZE> tx_ring;
+static bool serial_ready = false; // A UART answered and the IRQ is set up
+
+// Moves up to a FIFO's worth of queued bytes into the UART. The ring has a
+// single consumer, so this only runs with interrupts disabled.
+static void fill_fifo() {
+    if (!(inb(COM1_PORT + UART_LSR) & LSR_THR_EMPTY)) {
+        return;
+    }
+    char c;
+    for (int i = 0; i < UART_FIFO_SIZE && tx_ring.pop(c); ++i) {
+        outb(COM1_PORT + UART_DATA, (uint8_t)c);
+    }
+}
+
+static void serial_irq() {
+    inb(COM1_PORT + UART_IIR); // Acknowledges the THR-empty interrupt
+    fill_fifo();
+    if (tx_ring.empty()) {
+        // Nothing left: no more interrupts until the next write re-arms them.
+        outb(COM1_PORT + UART_IER, 0);
+    }
+}
+
+static void serial_queue(char c) {
+    while (!tx_ring.push(c)) {
+        if (!serial_ready) {
+            return; // No UART to drain the ring: drop
+        }
+        // Output is outrunning the line; send some by hand to make room.
+        uint32_t flags = interrupts_save_disable();
+        fill_fifo();
+        interrupts_restore(flags);
+    }
+}
+
+// --- Serial Function Definitions ---
+
+INIT_CODE void serial_init() {
+    outb(COM1_PORT + UART_IER, 0);
+
+    // No UART at this port: reads float high.
+    if (inb(COM1_PORT + UART_LSR) == 0xFF) {
+        klog(KLOG_WARN, "serial", "No UART at COM1, serial console disabled");
+        return;
+    }
+
+    outb(COM1_PORT + UART_LCR, LCR_DLAB);
+    outb(COM1_PORT + UART_DATA, UART_DIVISOR & 0xFF);
+    outb(COM1_PORT + UART_IER, UART_DIVISOR >> 8);
+    outb(COM1_PORT + UART_LCR, LCR_8N1);
+    outb(COM1_PORT + UART_FCR, FCR_ENABLE);
+    outb(COM1_PORT + UART_MCR, MCR_DTR_RTS_OUT2);
+
+    irq_install_handler(IRQ_COM1, serial_irq);
+    serial_ready = true;
+    console_add_sink(serial_write);
+    klog(KLOG_DEBUG, "serial", "COM1 at %#x, %u baud, IRQ %d", COM1_PORT, 115200 / UART_DIVISOR, IRQ_COM1);
+}
+
+void serial_write(const char* text, size_t n) {
+    for (size_t i = 0; i < n; ++i) {
+        if (text[i] == '\n') {
+            serial_queue('\r');
+        }
+        serial_queue(text[i]);
+    }
+    if (serial_ready && n > 0) {
+        // (Re)arm the interrupt. If the FIFO is already empty it fires at
+        // once and starts sending.
+        outb(COM1_PORT + UART_IER, IER_THR_EMPTY);
+    }
+}
+
+void serial_flush() {
+    if (!serial_ready) {
+        return;
+    }
+    uint32_t flags = interrupts_save_disable();
+    while (!tx_ring.empty()) {
+        fill_fifo();
+    }
+    interrupts_restore(flags);
+}
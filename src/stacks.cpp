@@ -0,0 +1,67 @@
+#include "include/stacks.h"
+
+// --- Stack Registry ---
+// Constant-initialised, so the boot stack is known without any setup call.
+
+struct stack_region {
+    const char* name;
+    uint32_t* bottom; // Lowest address (stacks grow down towards it)
+    uint32_t* top;    // One past the highest address
+};
+
+static stack_region stacks[MAX_STACKS] = {
+    { "boot", (uint32_t*)stack_bottom, (uint32_t*)stack_top },
+};
+static int registered = 1;
+
+void stack_paint(void* bottom, void* top) {
+    for (uint32_t* p = (uint32_t*)bottom; p < (uint32_t*)top; ++p) {
+        *p = STACK_PAINT;
+    }
+}
+
+bool stack_register(const char* name, void* bottom, void* top) {
+    if (registered >= MAX_STACKS) {
+        return false;
+    }
+    // Only whole words are scanned.
+    uintptr_t lo = ((uintptr_t)bottom + 3) & ~(uintptr_t)3;
+    uintptr_t hi = (uintptr_t)top & ~(uintptr_t)3;
+    stacks[registered].name = name;
+    stacks[registered].bottom = (uint32_t*)lo;
+    stacks[registered].top = (uint32_t*)hi;
+    registered++;
+    return true;
+}
+
+int stack_count() {
+    return registered;
+}
+
+// --- Scanning ---
+
+static inline uintptr_t current_esp() {
+    uintptr_t esp;
+    asm volatile("mov %%esp, %0" : "=r"(esp));
+    return esp;
+}
+
+bool stack_get_usage(int index, stack_usage* out) {
+    if (index < 0 || index >= registered) {
+        return false;
+    }
+    const stack_region& s = stacks[index];
+
+    // The untouched part is at the bottom; stop at the first overwritten word.
+    const uint32_t* p = s.bottom;
+    while (p < s.top && *p == STACK_PAINT) {
+        ++p;
+    }
+
+    uintptr_t esp = current_esp();
+    out->name = s.name;
+    out->size = (uintptr_t)s.top - (uintptr_t)s.bottom;
+    out->peak_used = (uintptr_t)s.top - (uintptr_t)p;
+    out->used = (esp >= (uintptr_t)s.bottom && esp < (uintptr_t)s.top) ? (uintptr_t)s.top - esp : 0;
+    return true;
+}
@@ -0,0 +1,102 @@
+#include "include/strings.h"
+#include "include/inits.h" // For INIT_CODE
+#include "include/logs.h"  // For klog() when the self-check fails
+
+// --- string ---
+
+uint32_t string::hash() const {
+    if (!hash_valid) {
+        cached_hash = str_hash(c_str(), size());
+        hash_valid = true;
+    }
+    return cached_hash;
+}
+
+// True if 's' points into our own buffer (s.append(s), s = s.view().substr(k)).
+// Such a view dies with the buffer when it is reallocated.
+bool string::aliases(string_view s) const {
+    return chars.capacity() > 0 && s.data() >= chars.data() && s.data() < chars.data() + chars.capacity();
+}
+
+bool string::append(string_view s) {
+    if (s.empty()) return true;
+    size_t old_size = size();
+    // Our own text: keep its offset, the reservation may move the buffer
+    bool self = aliases(s);
+    size_t self_offset = self ? (size_t)(s.data() - chars.data()) : 0;
+    // One reservation for the characters and the terminator
+    chars.reserve(old_size + s.size() + 1);
+    if (chars.capacity() < old_size + s.size() + 1) return false; // OOM
+    const char* src = self ? chars.data() + self_offset : s.data();
+    if (!chars.empty()) chars.pop_back(); // Drop the old terminator
+    chars.append(src, s.size()); // No reallocation: already reserved
+    chars.push_back('\0');
+    changed();
+    return true;
+}
+
+void string::pop_back() {
+    if (empty()) return;
+    chars.pop_back();      // Terminator
+    chars.pop_back();      // Last character
+    chars.push_back('\0'); // Fits: the capacity is unchanged
+    changed();
+}
+
+void string::clear() {
+    chars.clear();
+    changed();
+}
+
+string& string::operator=(string_view s) {
+    if (aliases(s)) {
+        // Assigning part of ourselves: slide it to the front and cut the
+        // rest off (the ranges may overlap)
+        if (s.size() > 0) memmove(chars.data(), s.data(), s.size());
+        chars.resize(s.size());
+        if (s.size() > 0) chars.push_back('\0');
+        changed();
+        return *this;
+    }
+    clear();
+    append(s);
+    return *this;
+}
+
+bool operator==(const string& a, const string& b) {
+    if (a.size() != b.size()) return false;
+    if (a.hash() != b.hash()) return false;
+    return memcmp(a.data(), b.data(), a.size()) == 0;
+}
+
+// --- Self-Check ---
+// Assigning or appending a view of a string to itself reads from the buffer
+// that is being rewritten (and maybe reallocated); make sure that works.
+
+INIT_CODE static void check_text(const string& s, string_view expected, const char* what) {
+    if (s.view() != expected) {
+        klog(KLOG_ERR, "strings", "self-check failed: %s gave \"%.*s\"", what, (int)s.size(), s.c_str());
+    }
+}
+
+INIT_CODE void strings_self_check() {
+    string s("0123456789");
+    for (int i = 0; i < 3; ++i) {
+        s.append(s); // Grows past the first buffer, so it is reallocated on the way
+    }
+    bool repeated = s.size() == 80;
+    for (size_t i = 0; repeated && i < s.size(); ++i) {
+        repeated = s[i] == (char)('0' + i % 10);
+    }
+    if (!repeated) {
+        klog(KLOG_ERR, "strings", "self-check failed: self-append gave %u characters", (uint32_t)s.size());
+    }
+
+    string t("hello world");
+    t.append(t.view().substr(5)); // Overlaps the old terminator's slot
+    check_text(t, "hello world world", "append(substr)");
+    t = t.view().substr(6);       // Not at the start: the bytes slide down
+    check_text(t, "world world", "operator=(substr)");
+    t = t.view().substr(0, 5);    // A prefix
+    check_text(t, "world", "operator=(prefix)");
+}
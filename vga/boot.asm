@@ -53,7 +53,7 @@ reload_segments:
     out 0x92, al
     
     ; Call the kernel main function
-    push mboot_info_ptr          ; Pass multiboot info pointer to kernel
+    push dword [mboot_info_ptr]  ; Pass multiboot info pointer to kernel
     call main
     
     ; If the kernel returns, hang the CPU
@@ -23,7 +23,13 @@ g++ -m32 -ffreestanding -fno-exceptions -fno-rtti -O2 -c kernel.cpp -o build/ker
 
 # Link the kernel
 echo "Linking kernel..."
-ld -m elf_i386 -T linker.ld -o build/kernel.bin build/boot.o build/isr_assembly.o build/kernel.o
+ld -m elf_i386 -T linker.ld -o build/kernel.elf build/boot.o build/isr_assembly.o build/kernel.o
+
+# Split off the demand-paged assets (see include/paging.h): they go into a
+# boot module instead of being loaded with the kernel
+echo "Extracting assets..."
+objcopy --dump-section .assets=build/assets.bin build/kernel.elf
+objcopy --remove-section=.assets build/kernel.elf build/kernel.bin
 
 # Check if kernel.bin exists and has size greater than 0
 if [ ! -s build/kernel.bin ]; then
@@ -35,12 +41,14 @@ fi
 echo "Creating bootable ISO..."
 mkdir -p build/iso/boot/grub
 cp build/kernel.bin build/iso/boot/
+cp build/assets.bin build/iso/boot/
 cat > build/iso/boot/grub/grub.cfg << EOF
 set timeout=0
 set default=0
 
 menuentry "Cinemint OS" {
     multiboot /boot/kernel.bin
+    module /boot/assets.bin assets
     boot
 }
 EOF
@@ -1,7 +1,7 @@
 namespace sprite_don {
 const int width = 128;
 const int height = 87;
-const cm::pixel data[] = {
+const cm::pixel data[] CM_ASSET = {
 {5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 2, 2},{1, 2, 2},{1, 2, 2},{1, 2, 2},{2, 2, 2},{1, 1, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{4, 4, 4},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{3, 3, 3},{3, 3, 3},{3, 3, 3},{3, 3, 3},{3, 3, 3},{3, 3, 3},{3, 3, 3},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},
 {5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{3, 3, 3},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{2, 2, 2},{3, 3, 3},{3, 3, 3},{3, 3, 3},{3, 3, 3},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},
 {5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 1},{2, 2, 1},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{0, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{2, 2, 2},{2, 2, 2},{3, 3, 3},{3, 3, 3},{1, 1, 1},{0, 0, 0},{0, 0, 0},{2, 1, 1},{3, 2, 2},{3, 3, 3},{4, 3, 3},{4, 4, 4},{4, 4, 4},{4, 4, 4},{4, 4, 3},{4, 4, 3},{3, 3, 3},{2, 2, 2},{1, 1, 1},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{0, 0, 0},{1, 1, 1},{1, 1, 1},{3, 3, 3},{3, 3, 3},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{2, 2, 2},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},{1, 1, 1},
@@ -1,7 +1,7 @@
 namespace sprite_noki {
 const int width = 192;
 const int height = 152;
-const cm::pixel data[] = {
+const cm::pixel data[] CM_ASSET = {
 {5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 4, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 4, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{3, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 4, 4},{3, 4, 4},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
 {5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{4, 5, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 4, 4},{3, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
 {5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 4, 4},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 4, 4},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 5, 5},{3, 5, 5},{3, 4, 5},{3, 5, 5},{3, 5, 5},{4, 5, 5},{3, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{3, 5, 5},{3, 4, 5},{3, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{4, 4, 5},{4, 5, 5},{4, 5, 5},{4, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},{5, 5, 5},
@@ -1,7 +1,7 @@
 namespace sprite_wood {
 const int width = 768;
 const int height = 480;
-const cm::pixel data[] = {
+const cm::pixel data[] CM_ASSET = {
 {1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 1},{2, 1, 1},{2, 1, 0},{2, 1, 0},{2, 1, 1},{2, 1, 1},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{2, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 0},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 1},{2, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 1},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},
 {1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 1},{2, 1, 1},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 1},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 1},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{2, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},
 {1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{2, 1, 1},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 1},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 0},{2, 1, 1},{2, 1, 0},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 1},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 1},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 0},{2, 1, 1},{2, 1, 1},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 1},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{2, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{2, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 1, 0},{1, 1, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},{1, 0, 0},
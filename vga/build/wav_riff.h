@@ -10,7 +10,7 @@ namespace wav_riff {
     const uint8_t BITS_PER_SAMPLE = 8;
     const uint32_t NUM_SAMPLES = 508822;
 
-    const uint8_t SAMPLES[NUM_SAMPLES] = {
+    const uint8_t SAMPLES[NUM_SAMPLES] CM_ASSET = {
         128, 128, 127, 127, 127, 128, 127, 127, 127, 127, 127, 127, 
         127, 127, 127, 127, 127, 127, 127, 127, 127, 128, 127, 127, 
         127, 128, 128, 127, 127, 127, 127, 127, 127, 127, 127, 128, 
@@ -97,9 +97,9 @@ private:
     static const int BD_COUNT = 32;
     ac97_bd buffer_descriptors[BD_COUNT] __attribute__((aligned(8)));
     
-    // Audio buffers
-    static const int BUFFER_SAMPLES = 1024;               // Buffer size in samples
-    uint16_t audio_buffers[BD_COUNT][BUFFER_SAMPLES * 2]; // 2 channels for stereo
+    // Audio buffers, one 4 KiB zeroed frame each (see alloc_zeroed_frame())
+    static const int BUFFER_SAMPLES = 1024;  // Buffer size in samples
+    uint16_t *audio_buffers[BD_COUNT];       // BUFFER_SAMPLES * 2 entries, 2 channels for stereo
     
     uint8_t current_buffer;
     bool initialized;
@@ -188,7 +188,7 @@ private:
     
 public:
     AC97Driver() : pci_bus(0), pci_device(0), pci_function(0),
-                  nabm_base(0), mixer_base(0), current_buffer(0), initialized(false) {}
+                  nabm_base(0), mixer_base(0), audio_buffers(), current_buffer(0), initialized(false) {}
     
     bool init() {
         // First, detect the hardware
@@ -218,14 +218,20 @@ public:
         
         // Initialize buffer descriptors
         for (int i = 0; i < BD_COUNT; i++) {
+            // Clear audio buffer: a fresh frame comes pre-zeroed, a reused one
+            // is cleared in place
+            if (!audio_buffers[i]) {
+                audio_buffers[i] = (uint16_t *)alloc_zeroed_frame();
+                if (!audio_buffers[i]) {
+                    return false; // Out of memory
+                }
+            } else {
+                zero_frame((uint32_t)audio_buffers[i]);
+            }
+
             buffer_descriptors[i].buffer_addr = (uint32_t)&audio_buffers[i][0];
             buffer_descriptors[i].buffer_samples = BUFFER_SAMPLES * 4; // 4 bytes per sample (16-bit stereo)
             buffer_descriptors[i].control = AC97_BD_IOC; // Interrupt on completion
-            
-            // Clear audio buffer
-            for (int j = 0; j < BUFFER_SAMPLES * 2; j++) {
-                audio_buffers[i][j] = 0;
-            }
         }
         
         // Reset the DMA engine
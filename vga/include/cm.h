@@ -4,8 +4,8 @@
 volatile uint64_t timer_ticks = 0;
 volatile bool frame_ready = false;
 
-volatile bool key_status[58] = {false};
-volatile bool key_hit[58] = {false};
+volatile bool key_status[KEY_STATE_COUNT] = {false}; // Key is down (level)
+volatile bool key_hit[KEY_STATE_COUNT] = {false};    // Key went down this frame (edge)
 
 volatile multiboot_info *mbi = nullptr;
 
@@ -58,6 +58,15 @@ volatile uint8_t *vga_memory_13h = (uint8_t *)0xA0000;
 volatile uint8_t *vesa_lfb = (uint8_t *)DEFAULT_LFB_ADDRESS;
 volatile uint8_t vesa_buffer[640 * 480 * 4];
 
+// Set whenever a pixel of vesa_buffer is drawn (plot_rgb). While it stays
+// clear, the screen already shows what the buffer holds, and cm::update()
+// only has to copy the mouse cursor's rectangles.
+bool frame_dirty = true;
+
+#include "paging.h"
+#include "input.h"
+#include "mouse.h"
+
 // Interrupt Descriptor Table structures
 struct idt_entry
 {
@@ -85,6 +94,9 @@ extern "C" void load_idt();
 
 // Assembly interrupt wrapper - to be defined in a separate assembly file
 extern "C" void isr_timer_wrapper();
+extern "C" void isr_page_fault_wrapper();
+extern "C" void isr_keyboard_wrapper();
+extern "C" void isr_mouse_wrapper();
 
 // Setup the IDT
 void idt_set_gate(uint8_t num, uint32_t base, uint16_t sel, uint8_t flags)
@@ -112,6 +124,15 @@ void idt_install()
     // For timer interrupt (IRQ 0) we'll need to define this in assembly later
     idt_set_gate(32 + IRQ_TIMER, (uint32_t)isr_timer_wrapper, 0x08, 0x8E);
 
+    // Keyboard (IRQ 1) feeds the input event queue, see input.h
+    idt_set_gate(32 + IRQ_KEYBOARD, (uint32_t)isr_keyboard_wrapper, 0x08, 0x8E);
+
+    // PS/2 mouse (IRQ 12, on the slave PIC), see mouse.h
+    idt_set_gate(32 + IRQ_MOUSE, (uint32_t)isr_mouse_wrapper, 0x08, 0x8E);
+
+    // Page faults (exception 14) load assets on demand, see paging.h
+    idt_set_gate(14, (uint32_t)isr_page_fault_wrapper, 0x08, 0x8E);
+
     // Load the IDT
     load_idt();
 }
@@ -152,8 +173,8 @@ void init_pic()
     outb(PIC1_DATA, 0x01);
     outb(PIC2_DATA, 0x01);
 
-    // Mask all interrupts except timer (IRQ0)
-    outb(PIC1_DATA, ~(1 << IRQ_TIMER)); // Enable only timer interrupt
+    // Mask all interrupts except timer (IRQ0) and keyboard (IRQ1)
+    outb(PIC1_DATA, ~((1 << IRQ_TIMER) | (1 << IRQ_KEYBOARD)));
     outb(PIC2_DATA, 0xFF);              // Mask all interrupts on PIC2
 }
 
@@ -248,52 +269,112 @@ void setup_full_256_color_palette()
     }
 }
 
-void plot_rgb(int x, int y, uint8_t r, uint8_t g, uint8_t b)
+// Palette index of an RGB color with components 0-5
+uint8_t rgb_color(uint8_t r, uint8_t g, uint8_t b)
 {
-    if (x <= 640 && x >= 0 && y <= 480 && y >= 0)
-    {
-        // Clamp RGB values to valid range
-        r = (r > 5) ? 5 : r;
-        g = (g > 5) ? 5 : g;
-        b = (b > 5) ? 5 : b;
+    // Clamp RGB values to valid range
+    r = (r > 5) ? 5 : r;
+    g = (g > 5) ? 5 : g;
+    b = (b > 5) ? 5 : b;
 
-        // Calculate color index in our palette (based on 6×6×6 RGB cube)
-        uint8_t color = 36 * r + 6 * g + b;
+    // Special case for white - redirect to the brightest grayscale entry
+    if (r == 5 && g == 5 && b == 5)
+    {
+        return 255; // Last grayscale entry (pure white)
+    }
 
-        // Special case for white - redirect to the brightest grayscale entry
-        if (r == 5 && g == 5 && b == 5)
-        {
-            color = 255; // Last grayscale entry (pure white)
-        }
+    // Calculate color index in our palette (based on 6×6×6 RGB cube)
+    return 36 * r + 6 * g + b;
+}
 
+void plot_rgb(int x, int y, uint8_t r, uint8_t g, uint8_t b)
+{
+    if (x <= 640 && x >= 0 && y <= 480 && y >= 0)
+    {
         // Set the pixel
-        vesa_buffer[y * 640 + x] = color;
+        vesa_buffer[y * 640 + x] = rgb_color(r, g, b);
+        frame_dirty = true;
     }
 }
 
+// Keyboard events taken by the last scankey(), oldest first
+key_event frame_key_events[KEY_QUEUE_SIZE];
+int frame_key_event_count = 0;
+
+// Takes every event queued since the last frame and updates the key state
+// from them. A key pressed and released within one frame still shows up in
+// key_hit for that frame.
 void scankey()
 {
-    for (int t = 0; t < 58; t++)
+    for (int t = 0; t < KEY_STATE_COUNT; t++)
     {
         key_hit[t] = false;
     }
 
-    if (inb(0x64) & 0x1)
+    frame_key_event_count = 0;
+    key_event event;
+    while (frame_key_event_count < KEY_QUEUE_SIZE && key_queue_pop(&event))
     {
-        uint8_t key = inb(0x60);
+        frame_key_events[frame_key_event_count++] = event;
+        input_latency_event(event.tsc);
 
-        if (key < 58)
+        if (event.code & KEY_EXTENDED)
         {
-            key_status[key] = true;
-            key_hit[key] = true;
+            continue; // Only in the event list, KeyCodes has no entries for these
+        }
+
+        uint8_t key = event.code & ~KEY_RELEASED;
+        if (event.code & KEY_RELEASED)
+        {
+            key_status[key] = false;
         }
-        else if (key > 128)
+        else
         {
-            key_status[key - 128] = false;
+            // Presses while the key is already down are typematic repeats, not hits
+            if (!key_status[key])
+            {
+                key_hit[key] = true;
+            }
+            key_status[key] = true;
         }
     }
 }
 
+// Mouse state, updated once per frame from mouse_queue
+int mouse_pos_x = 320;
+int mouse_pos_y = 240;
+uint8_t mouse_buttons = 0; // Held down (level)
+uint8_t mouse_clicked = 0; // Went down this frame (edge)
+int mouse_wheel = 0;       // Wheel clicks this frame
+
+// Mouse events taken by the last scanmouse(), oldest first
+mouse_event frame_mouse_events[MOUSE_QUEUE_SIZE];
+int frame_mouse_event_count = 0;
+
+// Same as scankey(), for the mouse. The position is kept on the screen.
+void scanmouse()
+{
+    mouse_clicked = 0;
+    mouse_wheel = 0;
+
+    frame_mouse_event_count = 0;
+    mouse_event event;
+    while (frame_mouse_event_count < MOUSE_QUEUE_SIZE && mouse_queue_pop(&event))
+    {
+        frame_mouse_events[frame_mouse_event_count++] = event;
+        input_latency_event(event.tsc);
+
+        mouse_pos_x += event.dx;
+        mouse_pos_y += event.dy;
+        mouse_pos_x = mouse_pos_x < 0 ? 0 : mouse_pos_x > 639 ? 639 : mouse_pos_x;
+        mouse_pos_y = mouse_pos_y < 0 ? 0 : mouse_pos_y > 479 ? 479 : mouse_pos_y;
+
+        mouse_clicked |= event.buttons & ~mouse_buttons;
+        mouse_buttons = event.buttons;
+        mouse_wheel += event.wheel;
+    }
+}
+
 namespace cm
 {
     struct pixel
@@ -314,6 +395,7 @@ namespace cm
     {
         const sprite_item *item;
         int x, y, prev_x, prev_y;
+        const sprite_item *prev_item; // What cls() saw, to notice animation
     };
 
     sprite_ptr sprites[256];
@@ -329,7 +411,9 @@ namespace cm
         my_sprite->y = y;
         my_sprite->prev_x = x;
         my_sprite->prev_y = y;
+        my_sprite->prev_item = item_;
         sprite_count++;
+        frame_dirty = true; // Not drawn yet
         return my_sprite;
     }
 
@@ -379,12 +463,66 @@ namespace cm
 
     bool keydown(uint8_t c)
     {
-        return key_status[c];
+        return c < KEY_STATE_COUNT && key_status[c];
     }
 
     bool keyhit(uint8_t c)
     {
-        return key_hit[c];
+        return c < KEY_STATE_COUNT && key_hit[c];
+    }
+
+    // The raw keyboard events of this frame, in the order they arrived, with
+    // their TSC timestamps (e.g. for text input or extended keys)
+    int key_event_count()
+    {
+        return frame_key_event_count;
+    }
+
+    const key_event &get_key_event(int i)
+    {
+        return frame_key_events[i];
+    }
+
+    int mousex()
+    {
+        return mouse_pos_x;
+    }
+
+    int mousey()
+    {
+        return mouse_pos_y;
+    }
+
+    // 'button' is one of MOUSE_LEFT, MOUSE_RIGHT, MOUSE_MIDDLE
+    bool mousedown(uint8_t button)
+    {
+        return (mouse_buttons & button) != 0;
+    }
+
+    bool mouseclick(uint8_t button)
+    {
+        return (mouse_clicked & button) != 0;
+    }
+
+    int mousewheel()
+    {
+        return mouse_wheel;
+    }
+
+    int mouse_event_count()
+    {
+        return frame_mouse_event_count;
+    }
+
+    const mouse_event &get_mouse_event(int i)
+    {
+        return frame_mouse_events[i];
+    }
+
+    // How long input waits before the screen shows it, see input.h
+    const input_latency_stats &get_input_latency()
+    {
+        return input_latency;
     }
 
     class PWMSpeaker
@@ -560,31 +698,180 @@ namespace cm
         pwmSpeaker.play();
     }
 
+    int max(int a, int b)
+    {
+        return a > b ? a : b;
+    }
+
+    int min(int a, int b)
+    {
+        return a < b ? a : b;
+    }
+
+    // --- Mouse Cursor ---
+    // The cursor is drawn over the finished frame right before it is copied
+    // to the screen, and taken off again right after. What it covers in
+    // vesa_buffer is saved first and put back afterwards (save-under), so
+    // vesa_buffer never keeps cursor pixels and cursor drawing does not count
+    // as a change to the frame. When nothing but the pointer changed,
+    // update() therefore neither redraws the sprites nor copies the whole
+    // frame: it copies the cursor's old rectangle (now the plain scene again)
+    // and its new one to the screen.
+    const int CURSOR_MAX = 32; // Largest cursor sprite, in both directions
+
+    // Cursor sprite pixels of this color are transparent
+    const pixel CURSOR_TRANSPARENT = {5, 0, 5};
+
+    const pixel CUR_T = CURSOR_TRANSPARENT;
+    const pixel CUR_B = {0, 0, 0};
+    const pixel CUR_W = {5, 5, 5};
+    // Default arrow: black outline, white inside, hot spot at the tip
+
+    const pixel default_cursor_pixels[12 * 19] = {
+        CUR_B, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T,
+        CUR_B, CUR_B, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T,
+        CUR_B, CUR_W, CUR_B, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T,
+        CUR_B, CUR_W, CUR_W, CUR_B, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T,
+        CUR_B, CUR_W, CUR_W, CUR_W, CUR_B, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T,
+        CUR_B, CUR_W, CUR_W, CUR_W, CUR_W, CUR_B, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T,
+        CUR_B, CUR_W, CUR_W, CUR_W, CUR_W, CUR_W, CUR_B, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T,
+        CUR_B, CUR_W, CUR_W, CUR_W, CUR_W, CUR_W, CUR_W, CUR_B, CUR_T, CUR_T, CUR_T, CUR_T,
+        CUR_B, CUR_W, CUR_W, CUR_W, CUR_W, CUR_W, CUR_W, CUR_W, CUR_B, CUR_T, CUR_T, CUR_T,
+        CUR_B, CUR_W, CUR_W, CUR_W, CUR_W, CUR_W, CUR_W, CUR_W, CUR_W, CUR_B, CUR_T, CUR_T,
+        CUR_B, CUR_W, CUR_W, CUR_W, CUR_W, CUR_W, CUR_W, CUR_W, CUR_W, CUR_W, CUR_B, CUR_T,
+        CUR_B, CUR_W, CUR_W, CUR_W, CUR_W, CUR_W, CUR_W, CUR_B, CUR_B, CUR_B, CUR_B, CUR_B,
+        CUR_B, CUR_W, CUR_W, CUR_W, CUR_B, CUR_W, CUR_W, CUR_B, CUR_T, CUR_T, CUR_T, CUR_T,
+        CUR_B, CUR_W, CUR_W, CUR_B, CUR_B, CUR_W, CUR_W, CUR_B, CUR_T, CUR_T, CUR_T, CUR_T,
+        CUR_B, CUR_W, CUR_B, CUR_T, CUR_T, CUR_B, CUR_W, CUR_W, CUR_B, CUR_T, CUR_T, CUR_T,
+        CUR_B, CUR_B, CUR_T, CUR_T, CUR_T, CUR_B, CUR_W, CUR_W, CUR_B, CUR_T, CUR_T, CUR_T,
+        CUR_B, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T, CUR_B, CUR_W, CUR_W, CUR_B, CUR_T, CUR_T,
+        CUR_T, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T, CUR_B, CUR_W, CUR_W, CUR_B, CUR_T, CUR_T,
+        CUR_T, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T, CUR_T, CUR_B, CUR_B, CUR_T, CUR_T, CUR_T,
+    };
+
+    const sprite_item default_cursor = {12, 19, default_cursor_pixels};
+
+    const sprite_item *cursor = nullptr;
+    int cursor_hot_x = 0; // The pixel of the sprite that points at the mouse position
+    int cursor_hot_y = 0;
+    bool cursor_visible = false;
+
+    // The rectangle of vesa_buffer under the cursor while it is drawn
+    uint8_t cursor_save[CURSOR_MAX * CURSOR_MAX];
+    int cursor_save_x, cursor_save_y, cursor_save_w, cursor_save_h;
+    bool cursor_saved = false;
+
+    // Where the cursor was at the last present; w == 0 if it was not shown
+    int cursor_shown_x = 0, cursor_shown_y = 0, cursor_shown_w = 0, cursor_shown_h = 0;
+
+    // 'item' must be at most CURSOR_MAX pixels wide and high; use
+    // CURSOR_TRANSPARENT around the shape
+    void set_cursor(const sprite_item *item, int hot_x = 0, int hot_y = 0)
+    {
+        if (item->width > CURSOR_MAX || item->height > CURSOR_MAX)
+        {
+            return;
+        }
+        cursor = item;
+        cursor_hot_x = hot_x;
+        cursor_hot_y = hot_y;
+    }
+
+    void show_cursor(bool visible)
+    {
+        cursor_visible = visible;
+    }
+
+    void cursor_draw()
+    {
+        if (!cursor_visible || !cursor)
+        {
+            cursor_save_w = 0;
+            return;
+        }
+
+        // Clip the cursor rectangle to the screen
+        int left = mouse_pos_x - cursor_hot_x;
+        int top = mouse_pos_y - cursor_hot_y;
+        int x0 = max(left, 0);
+        int y0 = max(top, 0);
+        int x1 = min(left + cursor->width, 640);
+        int y1 = min(top + cursor->height, 480);
+        if (x0 >= x1 || y0 >= y1)
+        {
+            cursor_save_w = 0;
+            return;
+        }
+
+        cursor_save_x = x0;
+        cursor_save_y = y0;
+        cursor_save_w = x1 - x0;
+        cursor_save_h = y1 - y0;
+        cursor_saved = true;
+
+        for (int y = y0; y < y1; y++)
+        {
+            for (int x = x0; x < x1; x++)
+            {
+                cursor_save[(y - y0) * CURSOR_MAX + (x - x0)] = vesa_buffer[y * 640 + x];
+
+                const pixel *p = &cursor->data[(y - top) * cursor->width + (x - left)];
+                if (p->r != CURSOR_TRANSPARENT.r || p->g != CURSOR_TRANSPARENT.g || p->b != CURSOR_TRANSPARENT.b)
+                {
+                    vesa_buffer[y * 640 + x] = rgb_color(p->r, p->g, p->b);
+                }
+            }
+        }
+    }
+
+    void cursor_restore()
+    {
+        if (!cursor_saved)
+        {
+            return;
+        }
+        cursor_saved = false;
+
+        for (int y = 0; y < cursor_save_h; y++)
+        {
+            for (int x = 0; x < cursor_save_w; x++)
+            {
+                vesa_buffer[(cursor_save_y + y) * 640 + cursor_save_x + x] = cursor_save[y * CURSOR_MAX + x];
+            }
+        }
+    }
+
     void init(multiboot_info *mbi_)
     {
         mbi = mbi_;
 
         // Initialize interrupt system
         idt_install();
+
+        // Paging must be on before the first asset access
+        paging_init(mbi_);
         init_pic();
         init_timer();
+        mouse_init(); // Before interrupts: it polls the controller
         enable_interrupts(); // This is critical - enables the CPU to respond to interrupts
+        input_init();
 
         bool vesa_supported = false;
-        uint32_t framebuffer_width = 640;
-        uint32_t framebuffer_height = 480;
 
         // Check if multiboot provides a suitable framebuffer
         if (mbi && (mbi->flags & (1 << 12)))
         { // Bit 12 indicates framebuffer info is available
-            // Use the multiboot framebuffer info even if it's not exact match for our target
-            vesa_lfb = (volatile uint8_t *)(uint32_t)mbi->framebuffer_addr;
-            framebuffer_width = mbi->framebuffer_width;
-            framebuffer_height = mbi->framebuffer_height;
-
-            // If it's a usable framebuffer, we can proceed
-            if (vesa_lfb && framebuffer_width > 0 && framebuffer_height > 0)
+            // Only take it if it is exactly what update() copies into: a
+            // linear 640x480 framebuffer with one byte per pixel and no padding.
+            // GRUB also sets bit 12 in text mode, describing the EGA text
+            // buffer at 0xB8000 (type 2), which must not be written as pixels.
+            if (mbi->framebuffer_type == MULTIBOOT_FRAMEBUFFER_RGB &&
+                mbi->framebuffer_bpp == 8 &&
+                mbi->framebuffer_width == 640 && mbi->framebuffer_height == 480 &&
+                mbi->framebuffer_pitch == 640 &&
+                mbi->framebuffer_addr != 0 && (mbi->framebuffer_addr >> 32) == 0)
             {
+                vesa_lfb = (volatile uint8_t *)(uint32_t)mbi->framebuffer_addr;
                 vesa_supported = true;
             }
         }
@@ -593,21 +880,12 @@ namespace cm
         if (!vesa_supported)
         {
             vesa_supported = set_vesa_mode(640, 480, 8, &vesa_lfb);
-            framebuffer_width = 640;
-            framebuffer_height = 480;
         }
 
         setup_full_256_color_palette();
-    }
 
-    int max(int a, int b)
-    {
-        return a > b ? a : b;
-    }
-
-    int min(int a, int b)
-    {
-        return a < b ? a : b;
+        set_cursor(&default_cursor, 0, 0);
+        show_cursor(mouse_present);
     }
 
     void cls()
@@ -655,34 +933,115 @@ namespace cm
             // Update previous position
             sprites[sprite_loc].prev_x = x;
             sprites[sprite_loc].prev_y = y;
+            sprites[sprite_loc].prev_item = item;
+        }
+    }
+
+    // --- Frame Scratch Arena ---
+    // Bump allocator for data that only has to live until the end of the
+    // current frame. There is no per-allocation free: update() drops
+    // everything at once when the next frame starts, which is just a reset of
+    // the offset.
+    const uint32_t FRAME_SCRATCH_SIZE = 64 * 1024;
+    alignas(16) uint8_t frame_scratch[FRAME_SCRATCH_SIZE];
+    uint32_t frame_scratch_used = 0;
+    uint32_t frame_scratch_peak = 0; // Largest per-frame usage seen, for tuning the size
+
+    // 'align' must be a power of two. Returns nullptr when the frame's scratch
+    // space is used up.
+    void *frame_alloc(uint32_t bytes, uint32_t align = 16)
+    {
+        uint32_t offset = (frame_scratch_used + align - 1) & ~(align - 1);
+        if (offset > FRAME_SCRATCH_SIZE || bytes > FRAME_SCRATCH_SIZE - offset)
+        {
+            return nullptr;
+        }
+
+        frame_scratch_used = offset + bytes;
+        if (frame_scratch_used > frame_scratch_peak)
+        {
+            frame_scratch_peak = frame_scratch_used;
+        }
+        return &frame_scratch[offset];
+    }
+
+    void frame_reset()
+    {
+        frame_scratch_used = 0;
+    }
+
+    // Copies a rectangle of vesa_buffer to the screen
+    void present_rect(int x0, int y0, int w, int h)
+    {
+        for (int y = y0; y < y0 + h; y++)
+        {
+            for (int x = x0; x < x0 + w; x++)
+            {
+                vesa_lfb[y * 640 + x] = vesa_buffer[y * 640 + x];
+            }
         }
     }
 
     void update()
     {
+        // Unmoved, unchanged sprites are still in vesa_buffer from the last
+        // frame; they only need drawing again if something changed.
+        bool sprites_changed = false;
         for (int sprite_loc = 0; sprite_loc < sprite_count; sprite_loc++)
         {
-            const sprite_item *item = sprites[sprite_loc].item;
-            int x = sprites[sprite_loc].x;
-            int y = sprites[sprite_loc].y;
-            draw_sprite(item, x, y);
+            const sprite_ptr &s = sprites[sprite_loc];
+            if (s.x != s.prev_x || s.y != s.prev_y || s.item != s.prev_item)
+            {
+                sprites_changed = true;
+                break;
+            }
         }
 
-        for (int x = 0; x < 640; x++)
+        if (sprites_changed || frame_dirty)
         {
-            for (int y = 0; y < 480; y++)
+            for (int sprite_loc = 0; sprite_loc < sprite_count; sprite_loc++)
             {
-                vesa_lfb[y * 640 + x] = vesa_buffer[y * 640 + x];
+                const sprite_item *item = sprites[sprite_loc].item;
+                int x = sprites[sprite_loc].x;
+                int y = sprites[sprite_loc].y;
+                draw_sprite(item, x, y);
             }
         }
+        cursor_draw(); // On top of everything
 
-        // wait
+        if (frame_dirty)
+        {
+            present_rect(0, 0, 640, 480);
+            frame_dirty = false;
+        }
+        else
+        {
+            // Only the cursor may differ from what is on screen
+            present_rect(cursor_shown_x, cursor_shown_y, cursor_shown_w, cursor_shown_h);
+            present_rect(cursor_save_x, cursor_save_y, cursor_save_w, cursor_save_h);
+        }
+        cursor_shown_x = cursor_save_x;
+        cursor_shown_y = cursor_save_y;
+        cursor_shown_w = cursor_save_w;
+        cursor_shown_h = cursor_save_h;
+        input_latency_presented();
+        cursor_restore(); // Leave the buffer as the sprites left it
+
+        // wait, clearing pages for later zeroed allocations in the meantime
         while (!frame_ready)
-            asm volatile("hlt");
+        {
+            zero_pool_refill();
+            if (!frame_ready)
+                asm volatile("hlt");
+        }
         frame_ready = false;
 
+        // A new frame starts here: free last frame's scratch allocations.
+        frame_reset();
+
         cls();
         scankey();
+        scanmouse();
     }
 }
 
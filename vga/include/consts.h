@@ -153,6 +153,20 @@ struct multiboot_info
     uint8_t color_info[6];
 };
 
+// multiboot_info::framebuffer_type values
+#define MULTIBOOT_FRAMEBUFFER_INDEXED 0
+#define MULTIBOOT_FRAMEBUFFER_RGB 1
+#define MULTIBOOT_FRAMEBUFFER_EGA_TEXT 2
+
+// Entry of the boot module list at multiboot_info::mods_addr
+struct multiboot_module
+{
+    uint32_t mod_start;
+    uint32_t mod_end; // One past the last byte
+    uint32_t cmdline;
+    uint32_t reserved;
+};
+
 // VGA and VBE constants
 #define VGA_AC_INDEX 0x3C0
 #define VGA_AC_WRITE 0x3C0
@@ -227,6 +241,12 @@ struct multiboot_info
 // IRQ line definitions
 #define IRQ_TIMER 0
 #define IRQ_KEYBOARD 1
+#define IRQ_CASCADE 2 // The slave PIC
+#define IRQ_MOUSE 12
+
+// Entries of key_status/key_hit: one per set 1 scan code (a byte without the
+// release bit)
+#define KEY_STATE_COUNT 128
 
 // Frame rate target (in Hz)
 #define TARGET_FPS 60
\ No newline at end of file
@@ -0,0 +1,199 @@
+#ifndef INPUT_H
+#define INPUT_H
+
+#include <stdint.h>
+
+// Included from cm.h, after consts.h and the port helpers (inb, outb)
+
+// Keyboard event queue
+//
+// The keyboard raises IRQ 1 for every byte it sends. The handler reads the
+// byte, stamps it with the TSC and appends it to key_queue, so nothing is lost
+// between frames however fast keys are pressed. Once per frame, cm::update()
+// takes every queued event in one batch (scankey() in cm.h) and derives the
+// level (keydown) and edge (keyhit) state from them.
+//
+// The interrupt handler is the only writer of key_queue_head and the frame
+// loop the only writer of key_queue_tail, so the queue needs no lock.
+
+#define PS2_DATA 0x60
+#define PS2_STATUS 0x64
+#define PS2_STATUS_OUTPUT_FULL 0x01
+#define PS2_STATUS_INPUT_FULL 0x02
+#define PS2_STATUS_AUX 0x20 // The byte waiting in PS2_DATA is from the mouse (mouse.h)
+
+#define KEY_QUEUE_SIZE 256 // Power of two
+#define KEY_EXTENDED 0x100 // Set in key_event::code for E0-prefixed keys (arrows, right Ctrl...)
+#define KEY_RELEASED 0x80  // Set in key_event::code when the key went up
+
+struct key_event
+{
+    uint16_t code; // Scan code (set 1), plus KEY_EXTENDED
+    uint64_t tsc;  // Time stamp counter when the byte arrived
+};
+
+key_event key_queue[KEY_QUEUE_SIZE];
+volatile uint32_t key_queue_head = 0; // Next slot the interrupt handler fills
+volatile uint32_t key_queue_tail = 0; // Next slot scankey() takes
+volatile uint32_t key_events_dropped = 0; // Events lost to a full queue
+
+// Scan code prefix state, only touched by the interrupt handler
+bool key_prefix_e0 = false;
+int key_pause_bytes = 0; // Bytes of the Pause key's E1 sequence still to skip
+
+static inline uint64_t rdtsc()
+{
+    uint32_t lo, hi;
+    asm volatile("rdtsc" : "=a"(lo), "=d"(hi));
+    return ((uint64_t)hi << 32) | lo;
+}
+
+// Input-to-present latency
+//
+// For each frame that took input, the time from the oldest event of the batch
+// arriving to the end of the frame that shows its effect being copied to the
+// screen. This is what the frame loop adds on top of the keyboard's own delay:
+// up to one frame of waiting in the queue plus one frame of game logic and
+// drawing.
+struct input_latency_stats
+{
+    uint32_t last_us;  // Most recent frame with input
+    uint32_t max_us;   // Worst since boot
+    uint32_t avg_us;   // Moving average over roughly the last 16 samples
+    uint32_t samples;  // Frames with input measured so far
+};
+
+input_latency_stats input_latency = {0, 0, 0, 0};
+uint32_t tsc_per_us = 0;   // 0 until input_init() measured it
+uint64_t input_oldest_tsc = 0; // Oldest event drained but not yet presented, 0 if none
+
+// Must run with interrupts enabled and the timer running: it measures the TSC
+// rate against timer_ticks.
+void input_init()
+{
+    // Measure 10 timer ticks (~10 ms at 1000 Hz), starting on a tick edge
+    uint64_t start_tick = timer_ticks;
+    while (timer_ticks == start_tick)
+        asm volatile("hlt");
+    uint64_t start = rdtsc();
+    start_tick = timer_ticks;
+    while (timer_ticks - start_tick < 10)
+        asm volatile("hlt");
+    tsc_per_us = (uint32_t)(rdtsc() - start) / 10000; // 32 bits hold 10 ms below 400 GHz
+    if (tsc_per_us == 0)
+        tsc_per_us = 1;
+
+    // Throw away whatever the controller still holds from the boot loader, so
+    // the first keypress raises an interrupt
+    while (inb(PS2_STATUS) & PS2_STATUS_OUTPUT_FULL)
+        inb(PS2_DATA);
+}
+
+// Called from isr_keyboard_handler() for each byte the keyboard sends
+void key_queue_push(uint8_t byte)
+{
+    if (key_pause_bytes > 0)
+    {
+        key_pause_bytes--;
+        return;
+    }
+    if (byte == 0xE1)
+    {
+        // Pause sends E1 1D 45 E1 9D C5 and no release; it is not a key we track
+        key_pause_bytes = 5;
+        return;
+    }
+    if (byte == 0xE0)
+    {
+        key_prefix_e0 = true;
+        return;
+    }
+    if (byte == 0x00 || byte == 0xFF)
+    {
+        return; // Keyboard error / buffer overrun codes
+    }
+
+    key_event event;
+    event.code = byte | (key_prefix_e0 ? KEY_EXTENDED : 0);
+    event.tsc = rdtsc();
+    key_prefix_e0 = false;
+
+    uint32_t head = key_queue_head;
+    if (head - key_queue_tail == KEY_QUEUE_SIZE)
+    {
+        key_events_dropped++;
+        return;
+    }
+    key_queue[head & (KEY_QUEUE_SIZE - 1)] = event;
+    asm volatile("" ::: "memory"); // Event stored before it is published
+    key_queue_head = head + 1;
+}
+
+// Takes the oldest queued event. Returns false when the queue is empty.
+bool key_queue_pop(key_event *event)
+{
+    uint32_t tail = key_queue_tail;
+    if (tail == key_queue_head)
+    {
+        return false;
+    }
+    asm volatile("" ::: "memory"); // Head read before the event
+    *event = key_queue[tail & (KEY_QUEUE_SIZE - 1)];
+    asm volatile("" ::: "memory"); // Event copied before the slot is given back
+    key_queue_tail = tail + 1;
+    return true;
+}
+
+// Called for each event a frame takes from an input queue
+void input_latency_event(uint64_t tsc)
+{
+    if (input_oldest_tsc == 0 || tsc < input_oldest_tsc)
+    {
+        input_oldest_tsc = tsc;
+    }
+}
+
+// Called by cm::update() right after a frame was copied to the screen
+void input_latency_presented()
+{
+    if (input_oldest_tsc == 0)
+    {
+        return;
+    }
+
+    // Kept to 32 bits: the kernel is not linked against libgcc's 64-bit
+    // division. Anything over a second or so just saturates.
+    uint64_t cycles = rdtsc() - input_oldest_tsc;
+    uint32_t us = (cycles >> 32) ? 0xFFFFFFFF / tsc_per_us : (uint32_t)cycles / tsc_per_us;
+    input_oldest_tsc = 0;
+
+    input_latency.last_us = us;
+    if (us > input_latency.max_us)
+    {
+        input_latency.max_us = us;
+    }
+    if (input_latency.samples == 0)
+    {
+        input_latency.avg_us = us;
+    }
+    else
+    {
+        input_latency.avg_us = input_latency.avg_us - input_latency.avg_us / 16 + us / 16;
+    }
+    input_latency.samples++;
+}
+
+// C handler for the keyboard interrupt
+extern "C" void isr_keyboard_handler()
+{
+    uint8_t status = inb(PS2_STATUS);
+    if ((status & PS2_STATUS_OUTPUT_FULL) && !(status & PS2_STATUS_AUX))
+    {
+        key_queue_push(inb(PS2_DATA));
+    }
+
+    // Send End of Interrupt signal to PIC
+    outb(PIC1_COMMAND, PIC_EOI);
+}
+
+#endif // INPUT_H
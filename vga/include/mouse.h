@@ -0,0 +1,213 @@
+#ifndef MOUSE_H
+#define MOUSE_H
+
+#include <stdint.h>
+
+// Included from cm.h, after input.h
+
+// PS/2 mouse
+//
+// The mouse is the second (auxiliary) device of the keyboard controller and
+// raises IRQ 12 for every byte it sends. Its movement comes in packets of 3
+// bytes, or 4 when it has a wheel (the "IntelliMouse" mode, enabled by
+// mouse_init() if the mouse supports it). The interrupt handler puts each
+// packet back together and appends it to mouse_queue as one event, stamped
+// with the TSC like the keyboard's. cm::update() drains the queue once per
+// frame (scanmouse() in cm.h).
+
+#define PS2_CMD_READ_CONFIG 0x20
+#define PS2_CMD_WRITE_CONFIG 0x60
+#define PS2_CMD_ENABLE_AUX 0xA8
+#define PS2_CMD_WRITE_AUX 0xD4 // The next byte written to PS2_DATA goes to the mouse
+#define PS2_CONFIG_AUX_IRQ 0x02
+#define PS2_CONFIG_AUX_CLOCK_OFF 0x20
+
+#define MOUSE_SET_DEFAULTS 0xF6
+#define MOUSE_SET_SAMPLE_RATE 0xF3
+#define MOUSE_GET_ID 0xF2
+#define MOUSE_ENABLE_REPORTING 0xF4
+#define MOUSE_ACK 0xFA
+#define MOUSE_ID_WHEEL 3
+
+// Bits of mouse_event::buttons
+#define MOUSE_LEFT 0x01
+#define MOUSE_RIGHT 0x02
+#define MOUSE_MIDDLE 0x04
+
+#define MOUSE_QUEUE_SIZE 256 // Power of two
+
+struct mouse_event
+{
+    int16_t dx, dy;  // Movement in pixels, y pointing down like the screen
+    int8_t wheel;    // Wheel clicks, positive towards the user
+    uint8_t buttons; // MOUSE_* buttons held down
+    uint64_t tsc;    // Time stamp counter when the packet started
+};
+
+mouse_event mouse_queue[MOUSE_QUEUE_SIZE];
+volatile uint32_t mouse_queue_head = 0; // Next slot the interrupt handler fills
+volatile uint32_t mouse_queue_tail = 0; // Next slot scanmouse() takes
+volatile uint32_t mouse_events_dropped = 0; // Packets lost to a full queue
+
+bool mouse_present = false;
+int mouse_packet_size = 3;
+
+// Packet being put together, only touched by the interrupt handler
+uint8_t mouse_packet[4];
+int mouse_packet_len = 0;
+uint64_t mouse_packet_tsc = 0;
+
+// The controller is slow; give up after a while instead of hanging when
+// there is no mouse
+bool ps2_wait_write()
+{
+    for (int i = 0; i < 100000; i++)
+    {
+        if (!(inb(PS2_STATUS) & PS2_STATUS_INPUT_FULL))
+            return true;
+    }
+    return false;
+}
+
+bool ps2_wait_read()
+{
+    for (int i = 0; i < 100000; i++)
+    {
+        if (inb(PS2_STATUS) & PS2_STATUS_OUTPUT_FULL)
+            return true;
+    }
+    return false;
+}
+
+void ps2_command(uint8_t command)
+{
+    ps2_wait_write();
+    outb(PS2_STATUS, command);
+}
+
+// Sends a byte to the mouse and waits for its acknowledgement
+bool mouse_write(uint8_t value)
+{
+    ps2_command(PS2_CMD_WRITE_AUX);
+    ps2_wait_write();
+    outb(PS2_DATA, value);
+    return ps2_wait_read() && inb(PS2_DATA) == MOUSE_ACK;
+}
+
+bool mouse_set_sample_rate(uint8_t rate)
+{
+    return mouse_write(MOUSE_SET_SAMPLE_RATE) && mouse_write(rate);
+}
+
+// Polls the controller, so it must run with interrupts disabled (the keyboard
+// handler would take the replies otherwise), after init_pic()
+void mouse_init()
+{
+    while (inb(PS2_STATUS) & PS2_STATUS_OUTPUT_FULL)
+        inb(PS2_DATA);
+
+    ps2_command(PS2_CMD_ENABLE_AUX);
+
+    // Let the mouse interrupt on IRQ 12 and make sure its clock runs
+    ps2_command(PS2_CMD_READ_CONFIG);
+    if (!ps2_wait_read())
+        return;
+    uint8_t config = inb(PS2_DATA);
+    config = (config | PS2_CONFIG_AUX_IRQ) & ~PS2_CONFIG_AUX_CLOCK_OFF;
+    ps2_command(PS2_CMD_WRITE_CONFIG);
+    ps2_wait_write();
+    outb(PS2_DATA, config);
+
+    if (!mouse_write(MOUSE_SET_DEFAULTS))
+        return; // No mouse
+
+    // This sample rate sequence switches a wheel mouse to 4-byte packets; it
+    // then reports ID 3 instead of 0
+    mouse_set_sample_rate(200);
+    mouse_set_sample_rate(100);
+    mouse_set_sample_rate(80);
+    if (mouse_write(MOUSE_GET_ID) && ps2_wait_read() && inb(PS2_DATA) == MOUSE_ID_WHEEL)
+    {
+        mouse_packet_size = 4;
+    }
+
+    if (!mouse_write(MOUSE_ENABLE_REPORTING))
+        return;
+    mouse_present = true;
+
+    // IRQ 12 is on the slave PIC, which is behind IRQ 2 of the master
+    outb(PIC1_DATA, inb(PIC1_DATA) & ~(1 << IRQ_CASCADE));
+    outb(PIC2_DATA, inb(PIC2_DATA) & ~(1 << (IRQ_MOUSE - 8)));
+}
+
+// Called from isr_mouse_handler() for each byte the mouse sends
+void mouse_packet_byte(uint8_t byte)
+{
+    // Bit 3 of the first byte is always set. If it is not, a byte went
+    // missing: skip until something that can start a packet comes by.
+    if (mouse_packet_len == 0)
+    {
+        if (!(byte & 0x08))
+            return;
+        mouse_packet_tsc = rdtsc();
+    }
+
+    mouse_packet[mouse_packet_len++] = byte;
+    if (mouse_packet_len < mouse_packet_size)
+        return;
+    mouse_packet_len = 0;
+
+    // Byte 0: buttons in bits 0-2, sign bits of x and y in bits 4 and 5 (the
+    // 9th bit of the two movement bytes), overflow flags in bits 6 and 7
+    uint8_t flags = mouse_packet[0];
+    if (flags & 0xC0)
+        return; // Moved too fast to be measured, the numbers mean nothing
+
+    mouse_event event;
+    event.dx = (int16_t)(mouse_packet[1] - ((flags << 4) & 0x100));
+    event.dy = (int16_t)(((flags << 3) & 0x100) - mouse_packet[2]); // The mouse counts y upwards
+    event.wheel = mouse_packet_size == 4 ? (int8_t)(mouse_packet[3] << 4) >> 4 : 0; // Low 4 bits, signed
+    event.buttons = flags & (MOUSE_LEFT | MOUSE_RIGHT | MOUSE_MIDDLE);
+    event.tsc = mouse_packet_tsc;
+
+    uint32_t head = mouse_queue_head;
+    if (head - mouse_queue_tail == MOUSE_QUEUE_SIZE)
+    {
+        mouse_events_dropped++;
+        return;
+    }
+    mouse_queue[head & (MOUSE_QUEUE_SIZE - 1)] = event;
+    asm volatile("" ::: "memory"); // Event stored before it is published
+    mouse_queue_head = head + 1;
+}
+
+// Takes the oldest queued event. Returns false when the queue is empty.
+bool mouse_queue_pop(mouse_event *event)
+{
+    uint32_t tail = mouse_queue_tail;
+    if (tail == mouse_queue_head)
+    {
+        return false;
+    }
+    asm volatile("" ::: "memory"); // Head read before the event
+    *event = mouse_queue[tail & (MOUSE_QUEUE_SIZE - 1)];
+    asm volatile("" ::: "memory"); // Event copied before the slot is given back
+    mouse_queue_tail = tail + 1;
+    return true;
+}
+
+// C handler for the mouse interrupt
+extern "C" void isr_mouse_handler()
+{
+    uint8_t status = inb(PS2_STATUS);
+    if ((status & PS2_STATUS_OUTPUT_FULL) && (status & PS2_STATUS_AUX))
+    {
+        mouse_packet_byte(inb(PS2_DATA));
+    }
+
+    // IRQ 12 came through both PICs, both need their End of Interrupt
+    outb(PIC2_COMMAND, PIC_EOI);
+    outb(PIC1_COMMAND, PIC_EOI);
+}
+
+#endif // MOUSE_H
@@ -0,0 +1,250 @@
+#ifndef PAGING_H
+#define PAGING_H
+
+#include <stdint.h>
+
+// Included from cm.h, after consts.h (multiboot_info, memset)
+
+// Demand-paged assets
+//
+// Sprite pixels and audio samples are tagged CM_ASSET, which puts them in the
+// .assets section. linker.ld links that section at ASSET_BASE, and build.sh
+// cuts it out of kernel.bin into build/assets.bin, which GRUB loads as a boot
+// module. Nothing of it is resident when main() starts.
+//
+// paging_init() identity-maps the whole 4 GiB address space with 4 MiB pages,
+// except for the asset window, which is mapped with 4 KiB pages that start out
+// not present. The first access to an asset page faults, and the page-fault
+// handler copies that page from the module into a fresh frame and maps it.
+// Assets that are never drawn or played never take any RAM.
+
+#define CM_ASSET __attribute__((section(".assets")))
+
+#define PAGE_SIZE 4096
+#define ASSET_BASE 0x40000000                     // Must match linker.ld
+#define ASSET_WINDOW_SIZE (16 * 1024 * 1024)       // Must match the ASSERT in linker.ld
+#define ASSET_TABLES (ASSET_WINDOW_SIZE / (4 * 1024 * 1024))
+
+#define PDE_PRESENT 0x01
+#define PDE_WRITABLE 0x02
+#define PDE_LARGE 0x80 // 4 MiB page (needs CR4.PSE)
+
+// Linker script symbols; only their addresses are meaningful
+extern "C" char kernel_end[];
+extern "C" char assets_start[];
+extern "C" char assets_end[];
+
+uint32_t page_directory[1024] __attribute__((aligned(PAGE_SIZE)));
+uint32_t asset_page_tables[ASSET_TABLES][1024] __attribute__((aligned(PAGE_SIZE)));
+
+// Where the page contents come from (the assets.bin boot module)
+const uint8_t *asset_module = nullptr;
+uint32_t asset_module_size = 0;
+
+// Physical frames for paged-in assets are bump-allocated from upper memory,
+// after the kernel and the boot modules. Asset pages are never evicted.
+uint32_t next_free_frame = 0;
+uint32_t frame_limit = 0;
+
+// Statistics
+volatile uint32_t asset_pages_loaded = 0;
+volatile uint32_t asset_pages_missing = 0; // Pages the module did not cover (zero-filled)
+
+// Halts for good. Used for faults that demand paging cannot resolve.
+static void paging_panic()
+{
+    while (true)
+    {
+        asm volatile("cli; hlt");
+    }
+}
+
+// Called both from the page-fault handler and, for the zero pool and AC97
+// buffers, from normal code with interrupts on. A fault taken between the
+// load and the store of next_free_frame (the timer ISR reading audio samples
+// pages them in) would hand out the same frame twice, so the bump runs with
+// interrupts off; popf restores IF as it was.
+static uint32_t alloc_frame()
+{
+    uint32_t flags;
+    asm volatile("pushf; pop %0; cli" : "=r"(flags) : : "memory");
+
+    uint32_t frame = 0;
+    if (next_free_frame + PAGE_SIZE <= frame_limit)
+    {
+        frame = next_free_frame;
+        next_free_frame += PAGE_SIZE;
+    }
+
+    asm volatile("push %0; popf" : : "r"(flags) : "memory", "cc");
+    return frame;
+}
+
+// Pre-zeroed frames
+// Frames cleared while the CPU would otherwise sit in hlt (see cm::update), so
+// that zeroed allocations, like the AC97 audio buffers, cost nothing later.
+#define ZERO_POOL_FRAMES 32
+#define ZERO_IDLE_BATCH 2 // Frames cleared per zero_pool_refill() call
+
+uint32_t zeroed_frames[ZERO_POOL_FRAMES];
+int zeroed_count = 0;
+
+static inline void zero_frame(uint32_t frame)
+{
+    uint32_t count = PAGE_SIZE / 4;
+    asm volatile("cld; rep stosl" : "+D"(frame), "+c"(count) : "a"(0) : "memory");
+}
+
+// Returns a zeroed, identity-mapped frame, or 0 when memory ran out
+uint32_t alloc_zeroed_frame()
+{
+    if (zeroed_count > 0)
+    {
+        return zeroed_frames[--zeroed_count];
+    }
+    uint32_t frame = alloc_frame();
+    if (frame)
+    {
+        zero_frame(frame);
+    }
+    return frame;
+}
+
+// Idle hook: tops up the pool by a few frames
+void zero_pool_refill()
+{
+    for (int i = 0; i < ZERO_IDLE_BATCH && zeroed_count < ZERO_POOL_FRAMES; i++)
+    {
+        uint32_t frame = alloc_frame();
+        if (!frame)
+        {
+            return;
+        }
+        zero_frame(frame);
+        zeroed_frames[zeroed_count++] = frame;
+    }
+}
+
+// Copies the asset page at 'page' (page aligned, inside the window) from the
+// module into a new frame and maps it.
+static void asset_page_in(uint32_t page)
+{
+    uint32_t frame = alloc_frame();
+    if (!frame)
+    {
+        paging_panic(); // Out of memory
+    }
+
+    // Frames below ASSET_BASE are identity-mapped, so they can be filled
+    // before they are mapped at their asset address.
+    uint32_t offset = page - (uint32_t)assets_start;
+    uint32_t *dst = (uint32_t *)frame;
+    uint32_t copy = 0;
+    if (asset_module && offset < asset_module_size)
+    {
+        copy = asset_module_size - offset;
+        if (copy > PAGE_SIZE)
+        {
+            copy = PAGE_SIZE;
+        }
+        const uint8_t *src = asset_module + offset;
+        for (uint32_t i = 0; i < copy; i++)
+        {
+            ((uint8_t *)dst)[i] = src[i];
+        }
+    }
+    else
+    {
+        asset_pages_missing++;
+    }
+    memset((uint8_t *)dst + copy, 0, PAGE_SIZE - copy);
+
+    uint32_t index = (page - ASSET_BASE) / PAGE_SIZE;
+    asset_page_tables[index / 1024][index % 1024] = frame | PDE_PRESENT;
+    asm volatile("invlpg (%0)" : : "r"(page) : "memory");
+    asset_pages_loaded++;
+}
+
+// C handler for the page fault exception (vector 14), called from
+// isr_page_fault_wrapper with CR2 and the CPU's error code.
+extern "C" void isr_page_fault_handler(uint32_t fault_addr, uint32_t error_code)
+{
+    bool not_present = !(error_code & 0x1);
+    if (not_present && fault_addr >= (uint32_t)assets_start && fault_addr < (uint32_t)assets_end)
+    {
+        asset_page_in(fault_addr & ~(PAGE_SIZE - 1));
+        return;
+    }
+
+    // Anything else is a real bug.
+    paging_panic();
+}
+
+// Finds the asset module and picks the frame range. The module is the first
+// one GRUB loaded (see the grub.cfg written by build.sh).
+static void find_asset_module(multiboot_info *mbi)
+{
+    uint32_t highest = (uint32_t)kernel_end;
+
+    if (mbi && (mbi->flags & (1 << 3)) && mbi->mods_count > 0)
+    { // Bit 3 indicates boot modules are available
+        multiboot_module *mods = (multiboot_module *)mbi->mods_addr;
+        asset_module = (const uint8_t *)mods[0].mod_start;
+        asset_module_size = mods[0].mod_end - mods[0].mod_start;
+
+        for (uint32_t i = 0; i < mbi->mods_count; i++)
+        {
+            if (mods[i].mod_end > highest)
+            {
+                highest = mods[i].mod_end;
+            }
+        }
+    }
+
+    next_free_frame = (highest + PAGE_SIZE - 1) & ~(PAGE_SIZE - 1);
+
+    // Upper memory is contiguous from 1 MiB; stay below the asset window,
+    // which hides the identity mapping of whatever RAM lies behind it.
+    uint32_t upper_end = 0x100000;
+    if (mbi && (mbi->flags & (1 << 0)))
+    {
+        upper_end += mbi->mem_upper * 1024;
+    }
+    frame_limit = upper_end < ASSET_BASE ? upper_end : ASSET_BASE;
+}
+
+// Builds the page tables and turns paging on. Must run before anything
+// touches an asset; the page-fault gate is installed by idt_install().
+void paging_init(multiboot_info *mbi)
+{
+    find_asset_module(mbi);
+
+    for (uint32_t i = 0; i < 1024; i++)
+    {
+        page_directory[i] = (i << 22) | PDE_LARGE | PDE_WRITABLE | PDE_PRESENT;
+    }
+
+    uint32_t first = ASSET_BASE >> 22;
+    for (uint32_t t = 0; t < ASSET_TABLES; t++)
+    {
+        for (uint32_t i = 0; i < 1024; i++)
+        {
+            asset_page_tables[t][i] = 0; // Not present until first touched
+        }
+        page_directory[first + t] = (uint32_t)&asset_page_tables[t][0] | PDE_WRITABLE | PDE_PRESENT;
+    }
+
+    asm volatile(
+        "mov %%cr4, %%eax\n\t"
+        "or $0x10, %%eax\n\t" // CR4.PSE: allow 4 MiB pages
+        "mov %%eax, %%cr4\n\t"
+        "mov %0, %%cr3\n\t"
+        "mov %%cr0, %%eax\n\t"
+        "or $0x80000000, %%eax\n\t" // CR0.PG
+        "mov %%eax, %%cr0\n\t"
+        :
+        : "r"(page_directory)
+        : "eax", "memory");
+}
+
+#endif // PAGING_H
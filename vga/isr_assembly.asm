@@ -2,8 +2,14 @@
 
 section .text
 global isr_timer_wrapper     ; Make the ISR handler visible to C code
+global isr_page_fault_wrapper
+global isr_keyboard_wrapper
+global isr_mouse_wrapper
 global load_idt              ; Make IDT loader visible to C code
 extern isr_timer_handler     ; Reference to the C handler function
+extern isr_page_fault_handler
+extern isr_keyboard_handler
+extern isr_mouse_handler
 extern idtp                  ; Reference to IDT pointer structure
 
 ; ISR for Timer (IRQ0)
@@ -13,6 +19,33 @@ isr_timer_wrapper:
     popa                     ; Pop all registers
     iret                     ; Return from interrupt
 
+; ISR for Keyboard (IRQ1)
+isr_keyboard_wrapper:
+    pusha                    ; Push all registers
+    call isr_keyboard_handler ; Call our C handler
+    popa                     ; Pop all registers
+    iret                     ; Return from interrupt
+
+; ISR for PS/2 Mouse (IRQ12)
+isr_mouse_wrapper:
+    pusha                    ; Push all registers
+    call isr_mouse_handler   ; Call our C handler
+    popa                     ; Pop all registers
+    iret                     ; Return from interrupt
+
+; ISR for Page Fault (exception 14)
+; The CPU pushes an error code, and CR2 holds the faulting address.
+isr_page_fault_wrapper:
+    pusha                    ; Push all registers
+    push dword [esp + 32]    ; Error code (above the 8 registers from pusha)
+    mov eax, cr2
+    push eax                 ; Faulting address
+    call isr_page_fault_handler
+    add esp, 8               ; Drop both arguments
+    popa                     ; Pop all registers
+    add esp, 4               ; Drop the error code before returning
+    iret                     ; Return and retry the faulting instruction
+
 ; Load IDT function
 load_idt:
     lidt [idtp]              ; Load the IDT pointer
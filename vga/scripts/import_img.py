@@ -32,7 +32,7 @@ for src in os.listdir("images"):
         f.write("namespace sprite_" + name + " {\n")
         f.write(f"const int width = {width};\n")
         f.write(f"const int height = {height};\n")
-        f.write("const cm::pixel data[] = {\n")
+        f.write("const cm::pixel data[] CM_ASSET = {\n")
         count = 0
         for pixel in pixels:
             f.write(f"{{{pixel[0]}, {pixel[1]}, {pixel[2]}}},")
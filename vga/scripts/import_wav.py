@@ -63,7 +63,7 @@ def wav_to_header(wav_file, raw):
             f.write('    const uint8_t BITS_PER_SAMPLE = %d;\n' % (sample_width * 8))
             f.write('    const uint32_t NUM_SAMPLES = %d;\n\n' % len(samples))
             
-            f.write('    const %s SAMPLES[NUM_SAMPLES] = {\n        ' % 
+            f.write('    const %s SAMPLES[NUM_SAMPLES] CM_ASSET = {\n        ' % 
                    ('uint8_t' if sample_width == 1 else 'int16_t'))
             
             # Write samples in rows of 12